@@ -26,8 +26,17 @@
 
 #import <CocoaLumberjack/CocoaLumberjack.h>
 #import "SproutDDLogAdditions.h"
-
-//C Compatibility
+#import "SproutLogLevels.h"
+#import "SproutLogLevelRegistry.h"
+#import "SproutLogCallSites.h"
+#import "SproutLogConfiguration.h"
+#import "SproutLogMacros.h"
+#import "SproutCLog.h"
+#import "SproutLogFields.h"
+#import "SproutLogQuery.h"
+#import "SproutRedactor.h"
+
+//C Compatibility (for plain C translation units, see SproutCLog.h)
 #define SPROUT_LOG_C_MACRO(async, lvl, flg, ctx, frmt, ...) \
 LOG_MACRO(async, lvl, flg, ctx, nil, __FUNCTION__, frmt, ##__VA_ARGS__)
 
@@ -44,36 +53,30 @@ LOG_MACRO(async, lvl, flg, ctx, nil, __FUNCTION__, frmt, ##__VA_ARGS__)
 //however if `SPROUT_DISABLE_DYNAMIC_LOG_LEVEL` is defined, the log level is static.
 
 #if DEBUG
-    #if SPROUT_DISABLE_DYNAMIC_LOG_LEVEL
-        #ifdef SPROUT_LOG_LEVEL
-            static const int ddLogLevel = SPROUT_LOG_LEVEL;
-        #else
-            static const int ddLogLevel = DDLogLevelVerbose;
-        #endif
+    #ifdef SPROUT_LOG_LEVEL
+        #define SPROUT_DEFAULT_LOG_LEVEL SPROUT_LOG_LEVEL
     #else
-        #ifdef SPROUT_LOG_LEVEL
-            static int ddLogLevel = SPROUT_LOG_LEVEL;
-        #else
-            static int ddLogLevel = DDLogLevelVerbose;
-        #endif
+        #define SPROUT_DEFAULT_LOG_LEVEL DDLogLevelVerbose
     #endif
     #define SPROUT_CONSOLE_LOGGING 1
 #else
-    #if SPROUT_DISABLE_DYNAMIC_LOG_LEVEL
-        #ifdef SPROUT_LOG_LEVEL
-            static const int ddLogLevel = SPROUT_LOG_LEVEL;
-        #else
-            static const int ddLogLevel = DDLogLevelWarning;
-        #endif
+    #ifdef SPROUT_LOG_LEVEL
+        #define SPROUT_DEFAULT_LOG_LEVEL SPROUT_LOG_LEVEL
     #else
-        #ifdef SPROUT_LOG_LEVEL
-            static int ddLogLevel = SPROUT_LOG_LEVEL;
-        #else
-            static int ddLogLevel = DDLogLevelWarning;
-        #endif
+        #define SPROUT_DEFAULT_LOG_LEVEL DDLogLevelWarning
     #endif
 #endif
 
+#if SPROUT_DISABLE_DYNAMIC_LOG_LEVEL
+    static const int ddLogLevel = SPROUT_DEFAULT_LOG_LEVEL;
+#else
+    //The dynamic log level is process wide (see SproutLogLevels.h), so every translation unit reads the same level.
+    //`ddLogLevel` remains for source compatibility only: changing it has no effect.
+    static int ddLogLevel __attribute__((unused, deprecated("Use -[Sprout setLogLevel:] or SproutLogLevelSet()"))) = SPROUT_DEFAULT_LOG_LEVEL;
+    #undef LOG_LEVEL_DEF
+    #define LOG_LEVEL_DEF SproutLogLevelCurrent()
+#endif
+
 //Sprout's internal loggers use this context.
 #define SPROUT_LOG_CONTEXT 60221413
 
@@ -104,6 +107,34 @@ LOG_MACRO(async, lvl, flg, ctx, nil, __FUNCTION__, frmt, ##__VA_ARGS__)
  */
 @property (nonatomic, copy) id<DDLogFormatter> (^logFormatterBlock)(id<DDLogFormatter> defaultLogFormatter);
 
+/**
+ A redactor which removes personal and secret information from every log message before it is formatted.
+ Each message is redacted once, however many loggers it is written to (see `SproutStagedLogFormatter`).
+ Changes to this property should be made before a call to `startLogging`.
+ */
+@property (nonatomic, strong) SproutRedactor *redactor;
+
+/**
+ * If `YES`, file logging is split into two tiers with different retention:
+ * the default file logger receives all messages, but only keeps a few hours of them, while a second file logger (see `highSeverityFileLogger`) receives only errors and warnings, and keeps them for 30 days.
+ * Each message is still only formatted once. Defaults to `NO`.
+ * Changes to this property should be made before a call to `startLogging`.
+ */
+@property (nonatomic, assign) BOOL tieredFileLogging;
+
+/**
+ * The file logger for errors and warnings when `tieredFileLogging` is enabled, otherwise `nil`.
+ * Its log files are kept in a "HighSeverity" directory within the default file logger's logs directory.
+ */
+@property (nonatomic, strong, readonly) DDFileLogger *highSeverityFileLogger;
+
+/**
+ * The location of an optional logging configuration file (see `SproutLogConfiguration`), which is watched, and applied each time it changes, so log levels can be changed without rebuilding the app.
+ * While the file exists the levels it sets take precedence over `setLogLevel:` and friends, and other levels (i.e. those set with `setLogLevel:forModule:`, or by `SproutLogLevelRegistry`) are left as they are. Levels which the file stops setting (all of them, when it is removed) are restored to their values from before it set them.
+ * Requires dynamic log levels. Changes to this property should be made before a call to `startLogging`.
+ */
+@property (nonatomic, strong) NSURL *logConfigurationURL;
+
 /**
  * @return `YES` if Sprout has configured CocoaLumberjack
  */
@@ -149,6 +180,64 @@ LOG_MACRO(async, lvl, flg, ctx, nil, __FUNCTION__, frmt, ##__VA_ARGS__)
  *   DDLogLevelVerbose
  */
 - (void)setLogLevel:(int)logLevel;
+
+/**
+ * Sets the logging level for messages logged with the given context, which takes precedence over the level set with `setLogLevel:`.
+ * @param logLevel The log level for the context. Takes affect immediately.
+ * @param context The log context.
+ * @see SproutLogLevels.h
+ */
+- (void)setLogLevel:(NSUInteger)logLevel forContext:(NSInteger)context;
+
+/**
+ * Temporarily raises the logging level for messages logged with the given context, i.e. while investigating an issue, reverting automatically once the duration has passed.
+ * While the burst lasts, messages with the context at `logLevel` are logged, whatever the other log levels. Calling this again for the context replaces its burst.
+ * @param logLevel The log level for the context during the burst.
+ * @param context The log context.
+ * @param duration How long the burst lasts, in seconds (measured with a monotonic clock, so unaffected by changes to the system clock).
+ */
+- (void)enableLevel:(NSUInteger)logLevel forContext:(NSInteger)context duration:(NSTimeInterval)duration;
+
+/**
+ * Sets the logging level for messages logged by the given module, which takes precedence over the levels set with `setLogLevel:` and `setLogLevel:forContext:`.
+ * @param logLevel The log level for the module. Takes affect immediately.
+ * @param module The module: either a `SPROUT_LOG_MODULE` name, or a source file name without extension (i.e. "MyViewController").
+ * @see SproutLogLevels.h
+ */
+- (void)setLogLevel:(NSUInteger)logLevel forModule:(NSString *)module;
+
+/**
+ * Removes the logging levels set with `setLogLevel:forContext:` and `setLogLevel:forModule:`.
+ */
+- (void)removeContextAndModuleLogLevels;
+
+/**
+ * Switches individual log statements on or off, whatever the log levels (see SproutLogCallSites.h).
+ * @param enabled `YES` to always log the matching statements, `NO` to never log them.
+ * @param file The statements' source file name (i.e. `@"MyViewController.m"`), or `nil` for any file.
+ * @param function The statements' function (i.e. `@"-[MyViewController viewDidLoad]"`), or `nil` for any function.
+ * @param line The statements' line number, or zero for any line.
+ * @return The number of statements matched.
+ */
+- (NSUInteger)setLoggingEnabled:(BOOL)enabled forCallSitesInFile:(NSString *)file function:(NSString *)function line:(NSUInteger)line;
+
+/**
+ * Returns all the statements switched with `setLoggingEnabled:forCallSitesInFile:function:line:` to following the log levels.
+ */
+- (void)resetLogCallSites;
+
+/**
+ * @param file A source file name (i.e. `@"MyViewController.m"`), or `nil` for all files.
+ * @return Descriptions of the log statements in the given file, of the form "MyViewController.m:42 -[MyViewController viewDidLoad] DDLogFlagDebug (enabled)".
+ */
+- (NSArray<NSString *> *)logCallSitesInFile:(NSString *)file;
+
+/**
+ * Applies the given logging configuration: the global, per-context and per-module log levels are replaced with those of the configuration, and the installed loggers it names are given their log levels.
+ * Loggers given a level by a previously applied configuration, but not by this one, get back their prior log level.
+ * @param configuration The configuration to apply, or `nil` to restore the default log level.
+ */
+- (void)applyLogConfiguration:(SproutLogConfiguration *)configuration;
 #endif
 
 #pragma mark - Logging Utilities
@@ -160,13 +249,26 @@ LOG_MACRO(async, lvl, flg, ctx, nil, __FUNCTION__, frmt, ##__VA_ARGS__)
 
 /**
  * @return An `NSArray` of `NSURL` objects containing the file URLs to the most recent (up to 10) log files. The first item in the array will be the most recently created log file.
+ * These are followed by the most recent (up to 10) log files of each file logger set with `setFileLogger:forContext:`, and with `tieredFileLogging`, of the high severity tier.
  */
 - (NSArray *)logFiles;
 
+/**
+ * Asynchronously searches the live and archived log files written by the default file logger, and by each file logger set with `setFileLogger:forContext:`, for records matching the given query.
+ * With `tieredFileLogging`, errors and warnings older than the default file logger's oldest log file are found in the high severity tier.
+ * A query with a `context` routed to its own file logger searches only that file logger's files (where every record has the context).
+ * See `SproutLogQueryEngine` for details.
+ *
+ * @param query The query describing the records to find.
+ * @param resultsHandler Called on the main queue (possibly many times) with batches of matching records as they are found.
+ * @param completion Called on the main queue once all log files have been searched. May be `nil`.
+ */
+- (void)searchLogsWithQuery:(SproutLogQuery *)query resultsHandler:(void(^)(NSArray<SproutLogRecord *> *records))resultsHandler completion:(void(^)(void))completion;
+
 #pragma mark - Loggers
 
 /**
- * Adds the given logger to CocoaLumberjack, with log level `DDLogLevelAll`, after configuring it with an instance of the default log formatter specified by the `defaultLogFormatterClass` property.
+ * Adds the given logger to CocoaLumberjack, with the log level last given for it to `setLogLevel:forLogger:` (or `DDLogLevelAll`), after configuring it with an instance of the default log formatter specified by the `defaultLogFormatterClass` property.
  *
  * @param logger The logger to add.
  */
@@ -174,11 +276,22 @@ LOG_MACRO(async, lvl, flg, ctx, nil, __FUNCTION__, frmt, ##__VA_ARGS__)
 
 /**
  * Adds the given logger to CocoaLumberjack, with the specified log level, after configuring it with an instance of the default log formatter specified by the `defaultLogFormatterClass` property.
+ * The log level is applied by the logger's formatter (a `SproutSharedLogFormatter`), so messages it filters out are not formatted for the logger. The logger must format its messages with its `logFormatter` (as CocoaLumberjack's and Sprout's loggers do).
  *
  * @param logger The logger to add.
+ * @param logLevel The log level of messages the logger receives.
  */
 - (void)addLogger:(id <DDLogger>)logger withLogLevel:(NSUInteger)logLevel;
 
+/**
+ * Sets the log level of the given logger. Takes affect immediately if the logger was added with `addLogger:` (i.e. the default loggers, and those returned by `loggersBlock`), and otherwise when it is.
+ * The logger stays installed, so no messages are lost and a `DDFileLogger` does not roll its log file. May be called from any thread (including a logger's queue).
+ *
+ * @param logLevel The log level of messages the logger receives.
+ * @param logger The logger.
+ */
+- (void)setLogLevel:(NSUInteger)logLevel forLogger:(id <DDLogger>)logger;
+
 /**
  * Removes the given logger from CocoaLumberjack
  *
@@ -198,6 +311,16 @@ LOG_MACRO(async, lvl, flg, ctx, nil, __FUNCTION__, frmt, ##__VA_ARGS__)
  */
 - (NSArray *)allLoggers;
 
+/**
+ * Routes log messages with the given context to the given file logger, rather than the default file logger, so the context gets its own log files (and its own size, rolling and retention settings).
+ * The messages are formatted once, with the default log formatter, so the file logger's own log formatter is not used. The file logger should have its own `logFileManager` and logs directory, and should not be added as a logger itself.
+ * Must be called before `startLogging`. See `SproutFileLogRouter` for details.
+ *
+ * @param fileLogger The file logger for messages with the given context. If `nil`, any file logger previously set for the context is removed.
+ * @param context The log context to route, i.e. `SPROUT_LOG_CONTEXT`.
+ */
+- (void)setFileLogger:(DDFileLogger *)fileLogger forContext:(NSInteger)context;
+
 #pragma mark - Helpers
 
 #pragma mark Device Info
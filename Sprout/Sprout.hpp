@@ -0,0 +1,283 @@
+//
+//  Sprout.hpp
+//
+//  Part of "Sprout" https://github.com/levigroker/Sprout
+//
+//  Created on October 19, 2026.
+//  Copyright (c) 2026 Levi Brown <mailto:levigroker@gmail.com> This work is
+//  licensed under the Creative Commons Attribution 4.0 International License. To
+//  view a copy of this license, visit https://creativecommons.org/licenses/by/4.0/
+//  or send a letter to Creative Commons, PO Box 1866, Mountain View, CA 94042, USA.
+//
+//  The above attribution and the included license must accompany any version of
+//  the source code, binary distributable, or derivatives.
+//
+
+/**
+ A type safe logging front end for C++ and Objective-C++ (C++17 or later):
+
+     #include <Sprout/Sprout.hpp>
+
+     SproutLogInfoCxx("Loaded {} of {} tiles in {}ms", loaded, total, milliseconds);
+     SPROUT_LOG_CXX(SPROUT_LOG_FLAG_DEBUG, kRendererLogContext, "Frame {} took {}s", frameIndex, duration);
+
+ Each `{}` in the format is replaced by the next argument (`{{` and `}}` stand for `{` and `}`). The format must be a
+ string literal, and it is checked at compile time: a malformed format, or a number of `{}` which differs from the
+ number of arguments, is a compile error, as is an argument of a type which can't be logged.
+
+ The arguments are written in a compact binary form (see SproutLogArguments.h) into a buffer on the caller's stack, and
+ the message is rendered from them later, when a logger first reads it, on the logger's queue. So the calling thread
+ does no text formatting, and the arguments cost a single allocation: the message, which holds a copy of them. The
+ file and function names are made into strings once per call site. The `DDLogMessage` is made as for any statement
+ (with the few allocations CocoaLumberjack makes for it). In Objective-C++, object arguments are logged as their
+ `description`, which is taken at the call site.
+
+ The level check is that of the `DDLog...` macros (see SproutLogLevels.h). With a static level
+ (`SPROUT_DISABLE_DYNAMIC_LOG_LEVEL`, with `Sprout.h` imported first) or `SPROUT_MODULE_MAX_LEVEL`, the check of a
+ disabled statement is a constant expression, and the whole statement, including its arguments, is compiled out.
+ Log call sites (see SproutLogCallSites.h) don't apply to these statements.
+ */
+
+#ifndef _SPROUT_HPP
+#define _SPROUT_HPP
+
+#ifdef __cplusplus
+
+#if __cplusplus < 201703L
+    #error "Sprout.hpp requires C++17 or later"
+#endif
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+#include "SproutCLog.h"
+#include "SproutLogArguments.h"
+#include "SproutLogLevels.h"
+
+#if SPROUT_DISABLE_DYNAMIC_LOG_LEVEL && defined(SPROUT_DEFAULT_LOG_LEVEL)
+    #define SPROUT_CXX_STATIC_LOG_LEVEL SPROUT_DEFAULT_LOG_LEVEL
+#endif
+
+namespace sprout
+{
+    /**
+     @return `false` if statements with the flag are compiled out, by a static log level or `SPROUT_MODULE_MAX_LEVEL`.
+     */
+    constexpr bool isCompiledIn(uint32_t flag)
+    {
+        (void)flag;
+#ifdef SPROUT_MODULE_MAX_LEVEL
+        if ((flag & (uint32_t)(SPROUT_MODULE_MAX_LEVEL)) == 0)
+        {
+            return false;
+        }
+#endif
+#ifdef SPROUT_CXX_STATIC_LOG_LEVEL
+        return (flag & (uint32_t)(SPROUT_CXX_STATIC_LOG_LEVEL)) != 0;
+#else
+        return true;
+#endif
+    }
+
+    /**
+     @return `true` if the log levels allow a statement with the flag, context and module.
+     */
+    inline bool isEnabled(uint32_t flag, intptr_t context, const char *module)
+    {
+#ifdef SPROUT_CXX_STATIC_LOG_LEVEL
+        return SproutLogLevelIsEnabled((uint32_t)(SPROUT_CXX_STATIC_LOG_LEVEL), flag, context, module);
+#else
+        return SproutLogLevelIsEnabled(SproutLogLevelCurrent(), flag, context, module);
+#endif
+    }
+
+    namespace detail
+    {
+        /**
+         @return The number of `{}` placeholders in the format, or -1 if it is malformed (an unmatched `{` or `}`).
+         */
+        constexpr int placeholderCount(const char *format)
+        {
+            int retVal = 0;
+            for (const char *p = format; *p; ++p)
+            {
+                if ((p[0] == '{' || p[0] == '}') && p[1] == p[0])
+                {
+                    ++p;
+                }
+                else if (p[0] == '{' && p[1] == '}')
+                {
+                    ++retVal;
+                    ++p;
+                }
+                else if (p[0] == '{' || p[0] == '}')
+                {
+                    return -1;
+                }
+            }
+            return retVal;
+        }
+
+        //Only used in `decltype`, to count the arguments without evaluating them
+        template <typename... Arguments>
+        std::integral_constant<int, (int)sizeof...(Arguments)> argumentCount(const Arguments &...);
+
+        template <typename T>
+        struct isUnsupported : std::false_type {};
+
+        //Writes arguments in the encoding of SproutLogArguments.h, dropping any which don't fit
+        class ArgumentWriter
+        {
+        public:
+            uint8_t bytes[SPROUT_LOG_ARGUMENTS_CAPACITY];
+            size_t length = 0;
+
+            void appendVarint(SproutLogArgumentType type, uint64_t value)
+            {
+                if (length + 1 + SPROUT_VARINT_MAX_LENGTH <= sizeof(bytes))
+                {
+                    bytes[length++] = (uint8_t)type;
+                    length += sproutVarintEncode(value, bytes + length);
+                }
+            }
+
+            void appendByte(SproutLogArgumentType type, uint8_t value)
+            {
+                if (length + 2 <= sizeof(bytes))
+                {
+                    bytes[length++] = (uint8_t)type;
+                    bytes[length++] = value;
+                }
+            }
+
+            void appendDouble(double value)
+            {
+                if (length + 1 + sizeof(value) <= sizeof(bytes))
+                {
+                    bytes[length++] = (uint8_t)SproutLogArgumentTypeDouble;
+                    std::memcpy(bytes + length, &value, sizeof(value));
+                    length += sizeof(value);
+                }
+            }
+
+            void appendString(std::string_view value)
+            {
+                if (length + 1 + SPROUT_VARINT_MAX_LENGTH > sizeof(bytes))
+                {
+                    return;
+                }
+
+                size_t available = sizeof(bytes) - length - 1 - SPROUT_VARINT_MAX_LENGTH;
+                size_t count = value.size() < available ? value.size() : available;
+                //Don't leave part of a UTF-8 sequence at the end of a truncated string
+                while (count < value.size() && count > 0 && ((uint8_t)value[count] & 0xC0) == 0x80)
+                {
+                    --count;
+                }
+
+                bytes[length++] = (uint8_t)SproutLogArgumentTypeString;
+                length += sproutVarintEncode(count, bytes + length);
+                std::memcpy(bytes + length, value.data(), count);
+                length += count;
+            }
+
+            template <typename T>
+            void append(const T &value)
+            {
+                using Type = std::decay_t<T>;
+
+                if constexpr (std::is_same_v<Type, bool>)
+                {
+                    appendByte(SproutLogArgumentTypeBool, value ? 1 : 0);
+                }
+                else if constexpr (std::is_same_v<Type, char>)
+                {
+                    appendByte(SproutLogArgumentTypeChar, (uint8_t)value);
+                }
+                else if constexpr (std::is_enum_v<Type>)
+                {
+                    append((std::underlying_type_t<Type>)value);
+                }
+                else if constexpr (std::is_integral_v<Type> && std::is_signed_v<Type>)
+                {
+                    appendVarint(SproutLogArgumentTypeInteger, sproutZigzagEncode((int64_t)value));
+                }
+                else if constexpr (std::is_integral_v<Type>)
+                {
+                    appendVarint(SproutLogArgumentTypeUnsigned, (uint64_t)value);
+                }
+                else if constexpr (std::is_floating_point_v<Type>)
+                {
+                    appendDouble((double)value);
+                }
+                else if constexpr (std::is_same_v<Type, char *> || std::is_same_v<Type, const char *>)
+                {
+                    const char *string = value;
+                    appendString(string ? std::string_view(string) : std::string_view("(null)"));
+                }
+                else if constexpr (std::is_convertible_v<const Type &, std::string_view>)
+                {
+                    appendString(std::string_view(value));
+                }
+#ifdef __OBJC__
+                else if constexpr (std::is_convertible_v<Type, id> && !std::is_same_v<Type, std::nullptr_t>)
+                {
+                    const char *description = [[(id)value description] UTF8String];
+                    appendString(description ? std::string_view(description) : std::string_view("(null)"));
+                }
+#endif
+                else if constexpr (std::is_pointer_v<Type> || std::is_same_v<Type, std::nullptr_t>)
+                {
+                    appendVarint(SproutLogArgumentTypePointer, (uint64_t)(uintptr_t)(const void *)value);
+                }
+                else
+                {
+                    static_assert(isUnsupported<Type>::value, "Sprout can't log arguments of this type");
+                }
+            }
+        };
+
+        template <typename... Arguments>
+        __attribute__((cold, noinline)) void log(uint32_t flag, intptr_t context, const char *file, const char *function, unsigned int line,
+                                                 const char *format, const Arguments &...arguments)
+        {
+            ArgumentWriter writer;
+            (writer.append(arguments), ...);
+            SproutLogArgumentsLog(flag, context, file, function, line, format, writer.bytes, writer.length);
+        }
+    }
+}
+
+/**
+ Logs a message with the given flag (i.e. `SPROUT_LOG_FLAG_INFO`) and context, if the log levels allow it.
+ The arguments are only evaluated if the statement is logged.
+ */
+#define SPROUT_LOG_CXX(flag, context, format, ...)                                                                   \
+        do                                                                                                           \
+        {                                                                                                            \
+            static_assert(::sprout::detail::placeholderCount(format) >= 0,                                          \
+                          "Malformed log format: use {} for an argument, and {{ or }} for a brace");               \
+            static_assert(::sprout::detail::placeholderCount(format) == decltype(::sprout::detail::argumentCount(__VA_ARGS__))::value, \
+                          "The number of {} in the log format differs from the number of arguments");               \
+            if constexpr (::sprout::isCompiledIn(flag))                                                              \
+            {                                                                                                        \
+                if (::sprout::isEnabled((flag), (context), SPROUT_LOG_MODULE))                                       \
+                {                                                                                                    \
+                    ::sprout::detail::log((flag), (context), __FILE__, __func__, __LINE__, (format), ## __VA_ARGS__); \
+                }                                                                                                    \
+            }                                                                                                        \
+        } while (0)
+
+#define SproutLogErrorCxx(format, ...)   SPROUT_LOG_CXX(SPROUT_LOG_FLAG_ERROR,   0, format, ## __VA_ARGS__)
+#define SproutLogWarnCxx(format, ...)    SPROUT_LOG_CXX(SPROUT_LOG_FLAG_WARNING, 0, format, ## __VA_ARGS__)
+#define SproutLogInfoCxx(format, ...)    SPROUT_LOG_CXX(SPROUT_LOG_FLAG_INFO,    0, format, ## __VA_ARGS__)
+#define SproutLogDebugCxx(format, ...)   SPROUT_LOG_CXX(SPROUT_LOG_FLAG_DEBUG,   0, format, ## __VA_ARGS__)
+#define SproutLogVerboseCxx(format, ...) SPROUT_LOG_CXX(SPROUT_LOG_FLAG_VERBOSE, 0, format, ## __VA_ARGS__)
+
+#endif /* __cplusplus */
+
+#endif /* _SPROUT_HPP */
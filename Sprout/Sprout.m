@@ -33,12 +33,20 @@ static NSString * const kSystemVersionKeyProductBuildVersion = @"ProductBuildVer
 static NSString * const kSysInfoKeyHardwarePlatform = @"hw.model";
 static NSString * const kSysInfoKeyHardwareMachine = @"hw.machine";
 static NSTimeInterval const kSignalReportingThresholdTimeInterval = 1.0f;
+static NSString * const kHighSeverityLogsDirectoryName = @"HighSeverity";
+static NSTimeInterval const kTieredLowSeverityRollingFrequency = 60 * 60; // 1 hour
+static NSTimeInterval const kTieredLowSeverityMaximumFileAge = 60 * 60 * 6; // 6 hours
+static NSTimeInterval const kTieredHighSeverityRollingFrequency = 60 * 60 * 24; // 24 hours
+static NSTimeInterval const kTieredHighSeverityMaximumFileAge = 60 * 60 * 24 * 30; // 30 days
 
 #import "Sprout.h"
 #import "SproutCustomLogFormatter.h"
+#import "SproutLogFileManager.h"
+#import "SproutFileLogRouter.h"
+#import "SproutSharedLogFormatter.h"
 
-#define DDLogException(frmt, ...)   LOG_MAYBE(NO, ddLogLevel, DDLogFlagError, 0, nil, "Exception Handler", frmt, ##__VA_ARGS__)
-#define DDLogSignal(frmt, ...)      LOG_MAYBE(NO, ddLogLevel, DDLogFlagError, 0, nil, "Signal Handler", frmt, ##__VA_ARGS__)
+#define DDLogException(frmt, ...)   LOG_MAYBE(NO, LOG_LEVEL_DEF, DDLogFlagError, 0, nil, "Exception Handler", frmt, ##__VA_ARGS__)
+#define DDLogSignal(frmt, ...)      LOG_MAYBE(NO, LOG_LEVEL_DEF, DDLogFlagError, 0, nil, "Signal Handler", frmt, ##__VA_ARGS__)
 
 #define SproutLogError(frmt, ...)   LOG_MAYBE(NO,                sproutInternalLogLevel, DDLogFlagError,   SPROUT_LOG_CONTEXT, nil, __PRETTY_FUNCTION__, @"[Sprout] "frmt, ##__VA_ARGS__)
 #define SproutLogWarn(frmt, ...)    LOG_MAYBE(LOG_ASYNC_ENABLED, sproutInternalLogLevel, DDLogFlagWarning, SPROUT_LOG_CONTEXT, nil, __PRETTY_FUNCTION__, @"[Sprout] "frmt, ##__VA_ARGS__)
@@ -56,7 +64,25 @@ NSString *lastSignal = nil;
 
 @property (nonatomic,assign) BOOL started;
 @property (nonatomic,strong) DDFileLogger *fileLogger;
+@property (nonatomic,strong) DDFileLogger *highSeverityFileLogger;
 @property (nonatomic,strong) NSMutableOrderedSet *startupMessageBlocks;
+@property (nonatomic,strong) SproutFileLogRouter *fileLogRouter;
+//One per log file manager searched
+@property (nonatomic,strong) NSMutableArray<SproutLogQueryEngine *> *logQueryEngines;
+@property (nonatomic,strong) NSMutableDictionary<NSNumber *, DDFileLogger *> *contextFileLoggers;
+@property (nonatomic,strong) NSMutableArray<id<DDLogFormatter>> *sharedLogFormatters;
+@property (nonatomic,strong) NSMapTable<id<DDLogger>, NSNumber *> *loggerLevels;
+//The formatters of the loggers added with `addLogger:`, which filter their messages by the logger's level. Guarded by
+//`loggerLevels`.
+@property (nonatomic,strong) NSMapTable<id<DDLogger>, SproutSharedLogFormatter *> *loggerFormatters;
+@property (nonatomic,strong) SproutLogConfigurationMonitor *logConfigurationMonitor;
+//The levels of the loggers before a configuration set them
+@property (nonatomic,strong) NSMapTable<id<DDLogger>, NSNumber *> *configuredLoggerLevels;
+//The global, context and module levels before a configuration set them (`NSNull` where none was set), only used on the
+//configuration monitor's queue
+@property (nonatomic,strong) NSNumber *configuredPriorLogLevel;
+@property (nonatomic,strong) NSMutableDictionary<NSNumber *, id> *configuredPriorContextLogLevels;
+@property (nonatomic,strong) NSMutableDictionary<NSString *, id> *configuredPriorModuleLogLevels;
 
 @end
 
@@ -133,6 +159,14 @@ void sproutSignalHandler(int signal)
     if ((self = [super init]))
     {
 		_startupMessageBlocks = [[NSMutableOrderedSet alloc] init];
+		_contextFileLoggers = [[NSMutableDictionary alloc] init];
+		_sharedLogFormatters = [[NSMutableArray alloc] init];
+		_logQueryEngines = [[NSMutableArray alloc] init];
+		_loggerLevels = [NSMapTable weakToStrongObjectsMapTable];
+		_loggerFormatters = [NSMapTable weakToStrongObjectsMapTable];
+		_configuredLoggerLevels = [NSMapTable weakToStrongObjectsMapTable];
+		_configuredPriorContextLogLevels = [[NSMutableDictionary alloc] init];
+		_configuredPriorModuleLogLevels = [[NSMutableDictionary alloc] init];
     }
     
     return self;
@@ -236,6 +270,17 @@ void sproutSignalHandler(int signal)
 		
         [self addDefaultLoggers];
 
+#if !SPROUT_DISABLE_DYNAMIC_LOG_LEVEL
+        if (self.logConfigurationURL)
+        {
+            __weak typeof(self) weakSelf = self;
+            self.logConfigurationMonitor = [[SproutLogConfigurationMonitor alloc] initWithURL:self.logConfigurationURL handler:^(SproutLogConfiguration *configuration) {
+                [weakSelf applyLogConfiguration:configuration];
+            }];
+            [self.logConfigurationMonitor start];
+        }
+#endif
+
         BOOL defaultLogLevel = YES;
         #ifdef SPROUT_LOG_LEVEL
         defaultLogLevel = NO;
@@ -248,7 +293,7 @@ void sproutSignalHandler(int signal)
 
 		__weak typeof(self) weakSelf = self;
 		[self addStartupMessageBlock:^{
-			SproutLogDebug(@"Log level %@ '%@'. Dynamic log level is %@abled.", defaultLogLevel ? @"defaulted to" : @"set by 'SPROUT_LOG_LEVEL' to", [weakSelf.class stringForLogLevel:LOG_LEVEL_DEF], dynamicLogLevel ? @"en" : @"dis");
+			SproutLogDebug(@"Log level %@ '%@'. Dynamic log level is %@abled.", defaultLogLevel ? @"defaulted to" : @"set by 'SPROUT_LOG_LEVEL' to", [weakSelf.class stringForLogLevel:SPROUT_DEFAULT_LOG_LEVEL], dynamicLogLevel ? @"en" : @"dis");
 		}];
 		
 		[self addStartupMessageBlock:^{
@@ -269,7 +314,226 @@ void sproutSignalHandler(int signal)
 #if !SPROUT_DISABLE_DYNAMIC_LOG_LEVEL
 - (void)setLogLevel:(int)logLevel
 {
-    ddLogLevel = logLevel;
+    SproutLogLevelSet((uint32_t)logLevel);
+}
+
+- (void)setLogLevel:(NSUInteger)logLevel forContext:(NSInteger)context
+{
+    SproutLogLevelSetForContext(context, (uint32_t)logLevel);
+}
+
+- (void)enableLevel:(NSUInteger)logLevel forContext:(NSInteger)context duration:(NSTimeInterval)duration
+{
+    SproutLogLevelEnableForContext(context, (uint32_t)logLevel, duration);
+}
+
+- (void)setLogLevel:(NSUInteger)logLevel forModule:(NSString *)module
+{
+    SproutLogLevelSetForModule(module.UTF8String, (uint32_t)logLevel);
+}
+
+- (void)removeContextAndModuleLogLevels
+{
+    SproutLogLevelRemoveAll();
+}
+
+- (NSUInteger)setLoggingEnabled:(BOOL)enabled forCallSitesInFile:(NSString *)file function:(NSString *)function line:(NSUInteger)line
+{
+    return SproutLogCallSitesSetState(file.UTF8String, function.UTF8String, (uint32_t)line, enabled ? SproutLogCallSiteStateEnabled : SproutLogCallSiteStateDisabled);
+}
+
+- (void)resetLogCallSites
+{
+    SproutLogCallSitesSetState(NULL, NULL, 0, SproutLogCallSiteStateDefault);
+}
+
+typedef struct
+{
+    const char *file;
+    void *descriptions;
+} SproutCallSiteDescriptions;
+
+static void sproutDescribeCallSite(SproutLogCallSite *site, void *info)
+{
+    SproutCallSiteDescriptions *callSiteDescriptions = info;
+    const char *fileName = site->file ?: "";
+    const char *slash = strrchr(fileName, '/');
+    if (slash)
+    {
+        fileName = slash + 1;
+    }
+
+    if (callSiteDescriptions->file && strcmp(fileName, callSiteDescriptions->file) != 0)
+    {
+        return;
+    }
+
+    NSString *flag = nil;
+    switch (site->flag)
+    {
+        case DDLogFlagError:
+            flag = @"DDLogFlagError";
+            break;
+        case DDLogFlagWarning:
+            flag = @"DDLogFlagWarning";
+            break;
+        case DDLogFlagInfo:
+            flag = @"DDLogFlagInfo";
+            break;
+        case DDLogFlagDebug:
+            flag = @"DDLogFlagDebug";
+            break;
+        default:
+            flag = @"DDLogFlagVerbose";
+            break;
+    }
+
+    NSString *state = site->state == SproutLogCallSiteStateEnabled ? @"enabled" : site->state == SproutLogCallSiteStateDisabled ? @"disabled" : @"default";
+
+    NSMutableArray<NSString *> *descriptions = (__bridge NSMutableArray<NSString *> *)callSiteDescriptions->descriptions;
+    [descriptions addObject:[NSString stringWithFormat:@"%s:%u %s %@ (%@)", fileName, site->line, site->function ?: "", flag, state]];
+}
+
+- (NSArray<NSString *> *)logCallSitesInFile:(NSString *)file
+{
+    NSMutableArray<NSString *> *retVal = [NSMutableArray array];
+
+    SproutCallSiteDescriptions callSiteDescriptions = { file.UTF8String, (__bridge void *)retVal };
+    SproutLogCallSitesEnumerate(sproutDescribeCallSite, &callSiteDescriptions);
+
+    return retVal;
+}
+
+//Adds the level changes which apply the configured levels to `levels`, and the keys whose levels are removed to `removals`,
+//restoring the prior levels of those no longer configured
+- (void)addLevelChanges:(NSMutableDictionary *)levels removals:(NSMutableArray *)removals forConfiguredLevels:(NSDictionary<id, NSNumber *> *)configuredLevels priorLevels:(NSMutableDictionary<id, id> *)priorLevels lookup:(NSNumber *(^)(id key))lookup
+{
+    for (id key in priorLevels.allKeys)
+    {
+        if (!configuredLevels[key])
+        {
+            id priorLevel = priorLevels[key];
+            if (priorLevel == [NSNull null])
+            {
+                [removals addObject:key];
+            }
+            else
+            {
+                levels[key] = priorLevel;
+            }
+            [priorLevels removeObjectForKey:key];
+        }
+    }
+
+    for (id key in configuredLevels)
+    {
+        if (!priorLevels[key])
+        {
+            priorLevels[key] = lookup(key) ?: [NSNull null];
+        }
+        levels[key] = configuredLevels[key];
+    }
+}
+
+- (void)applyLogConfiguration:(SproutLogConfiguration *)configuration
+{
+    //Only the levels the configuration sets are changed, so levels set in code (or by `SproutLogLevelRegistry`) are kept,
+    //and levels the configuration no longer sets (i.e. all of them, when the file is removed) are restored
+    NSMutableDictionary<NSNumber *, NSNumber *> *contextChanges = [NSMutableDictionary dictionary];
+    NSMutableArray<NSNumber *> *removedContexts = [NSMutableArray array];
+    [self addLevelChanges:contextChanges removals:removedContexts forConfiguredLevels:configuration.contextLogLevels priorLevels:self.configuredPriorContextLogLevels lookup:^NSNumber *(NSNumber *context) {
+        uint32_t level = 0;
+        return SproutLogLevelLookupForContext(context.integerValue, &level) ? @(level) : nil;
+    }];
+
+    NSMutableDictionary<NSString *, NSNumber *> *moduleChanges = [NSMutableDictionary dictionary];
+    NSMutableArray<NSString *> *removedModules = [NSMutableArray array];
+    [self addLevelChanges:moduleChanges removals:removedModules forConfiguredLevels:configuration.moduleLogLevels priorLevels:self.configuredPriorModuleLogLevels lookup:^NSNumber *(NSString *module) {
+        uint32_t level = 0;
+        return SproutLogLevelLookupForModule(module.UTF8String, &level) ? @(level) : nil;
+    }];
+
+    NSNumber *logLevel = configuration.logLevel;
+    if (logLevel && !self.configuredPriorLogLevel)
+    {
+        self.configuredPriorLogLevel = @(SproutLogLevelGet());
+    }
+    else if (!logLevel && self.configuredPriorLogLevel)
+    {
+        logLevel = self.configuredPriorLogLevel;
+        self.configuredPriorLogLevel = nil;
+    }
+
+    NSArray<NSNumber *> *contexts = contextChanges.allKeys;
+    intptr_t *contextValues = calloc(contexts.count + 1, sizeof(intptr_t));
+    uint32_t *contextLevels = calloc(contexts.count + 1, sizeof(uint32_t));
+    for (NSUInteger i = 0; i < contexts.count; ++i)
+    {
+        contextValues[i] = contexts[i].integerValue;
+        contextLevels[i] = (uint32_t)contextChanges[contexts[i]].unsignedIntegerValue;
+    }
+    intptr_t *removedContextValues = calloc(removedContexts.count + 1, sizeof(intptr_t));
+    for (NSUInteger i = 0; i < removedContexts.count; ++i)
+    {
+        removedContextValues[i] = removedContexts[i].integerValue;
+    }
+
+    NSArray<NSString *> *modules = moduleChanges.allKeys;
+    const char **moduleNames = calloc(modules.count + 1, sizeof(const char *));
+    uint32_t *moduleLevels = calloc(modules.count + 1, sizeof(uint32_t));
+    for (NSUInteger i = 0; i < modules.count; ++i)
+    {
+        moduleNames[i] = modules[i].UTF8String;
+        moduleLevels[i] = (uint32_t)moduleChanges[modules[i]].unsignedIntegerValue;
+    }
+    const char **removedModuleNames = calloc(removedModules.count + 1, sizeof(const char *));
+    for (NSUInteger i = 0; i < removedModules.count; ++i)
+    {
+        removedModuleNames[i] = removedModules[i].UTF8String;
+    }
+
+    uint32_t level = (uint32_t)logLevel.unsignedIntegerValue;
+    SproutLogLevelUpdate(logLevel ? &level : NULL,
+                         contextValues, contextLevels, contexts.count, removedContextValues, removedContexts.count,
+                         moduleNames, moduleLevels, modules.count, removedModuleNames, removedModules.count);
+
+    free(contextValues);
+    free(contextLevels);
+    free(removedContextValues);
+    free(moduleNames);
+    free(moduleLevels);
+    free(removedModuleNames);
+
+    //Per-logger levels
+    NSDictionary<NSString *, NSNumber *> *loggerLogLevels = configuration.loggerLogLevels;
+    for (id<DDLogger> logger in [self allLoggers])
+    {
+        NSString *loggerName = [logger respondsToSelector:@selector(loggerName)] ? logger.loggerName : nil;
+        NSNumber *loggerLevel = loggerName ? loggerLogLevels[loggerName] : nil;
+        NSNumber *priorLevel = nil;
+
+        @synchronized (self.loggerLevels)
+        {
+            priorLevel = [self.configuredLoggerLevels objectForKey:logger];
+            if (loggerLevel && !priorLevel)
+            {
+                [self.configuredLoggerLevels setObject:[self.loggerLevels objectForKey:logger] ?: @(DDLogLevelAll) forKey:logger];
+            }
+            else if (!loggerLevel && priorLevel)
+            {
+                [self.configuredLoggerLevels removeObjectForKey:logger];
+            }
+        }
+
+        if (loggerLevel)
+        {
+            [self setLogLevel:loggerLevel.unsignedIntegerValue forLogger:logger];
+        }
+        else if (priorLevel)
+        {
+            [self setLogLevel:priorLevel.unsignedIntegerValue forLogger:logger];
+        }
+    }
 }
 #endif
 
@@ -292,19 +556,129 @@ void sproutSignalHandler(int signal)
 
 - (NSArray *)logFiles
 {
-    NSUInteger maximumLogFilesToReturn = MIN(self.fileLogger.logFileManager.maximumNumberOfLogFiles, 10);
-    NSMutableArray *logFiles = [NSMutableArray arrayWithCapacity:maximumLogFilesToReturn];
-    NSArray *sortedLogFileInfos = [self.fileLogger.logFileManager sortedLogFileInfos];
-    for (int i = 0; i < MIN(sortedLogFileInfos.count, maximumLogFilesToReturn); ++i)
+    NSMutableArray *logFiles = [NSMutableArray array];
+    for (DDFileLogger *fileLogger in [self allFileLoggers])
+    {
+        [self addLogFilesOfFileLogger:fileLogger toArray:logFiles];
+    }
+    return logFiles;
+}
+
+//The default file logger, followed by the file loggers of each context (see `setFileLogger:forContext:`) and the high
+//severity tier, each once
+- (NSArray<DDFileLogger *> *)allFileLoggers
+{
+    if (self.fileLogRouter)
+    {
+        return self.fileLogRouter.fileLoggers;
+    }
+
+    return self.fileLogger ? @[self.fileLogger] : @[];
+}
+
+//Adds the URLs of the most recent (up to 10) log files of the given file logger
+- (void)addLogFilesOfFileLogger:(DDFileLogger *)fileLogger toArray:(NSMutableArray *)logFiles
+{
+    //A `maximumNumberOfLogFiles` of zero means there is no limit (as with the tiered file loggers)
+    NSUInteger maximumNumberOfLogFiles = fileLogger.logFileManager.maximumNumberOfLogFiles;
+    NSUInteger maximumLogFilesToReturn = maximumNumberOfLogFiles > 0 ? MIN(maximumNumberOfLogFiles, 10) : 10;
+    NSArray *sortedLogFileInfos = [fileLogger.logFileManager sortedLogFileInfos];
+    for (NSUInteger i = 0; i < MIN(sortedLogFileInfos.count, maximumLogFilesToReturn); ++i)
     {
         DDLogFileInfo *logFileInfo = [sortedLogFileInfos objectAtIndex:i];
-		NSURL *logFileURL = logFileInfo.filePath ? [NSURL fileURLWithPath:logFileInfo.filePath isDirectory:NO] : nil;
+        NSURL *logFileURL = logFileInfo.filePath ? [NSURL fileURLWithPath:logFileInfo.filePath isDirectory:NO] : nil;
         if (logFileURL)
         {
             [logFiles addObject:logFileURL];
         }
     }
-    return logFiles;
+}
+
+- (void)searchLogsWithQuery:(SproutLogQuery *)query resultsHandler:(void(^)(NSArray<SproutLogRecord *> *records))resultsHandler completion:(void(^)(void))completion
+{
+    NSArray<DDFileLogger *> *fileLoggers = [self allFileLoggers];
+
+    //None of the log formats which are searched record the context, so a context query searches only the files of the
+    //file logger the context is routed to, if no other context is routed there (every record in them has the context)
+    if (query.context)
+    {
+        DDFileLogger *contextFileLogger = [self.fileLogRouter fileLoggerForContext:query.context.integerValue];
+        if (contextFileLogger && contextFileLogger != self.fileLogRouter.defaultFileLogger && [self.fileLogRouter contextsForFileLogger:contextFileLogger].count == 1)
+        {
+            fileLoggers = @[contextFileLogger];
+            query = [query copy];
+            query.context = nil;
+        }
+    }
+
+    if (fileLoggers.count == 0)
+    {
+        SproutLogWarn(@"No file logger is installed, so there are no log files to search.");
+        if (completion)
+        {
+            dispatch_async(dispatch_get_main_queue(), completion);
+        }
+        return;
+    }
+
+    //The high severity tier holds copies of the errors and warnings in the default file logger's files, so it is only
+    //searched for those older than the oldest of them
+    SproutLogQuery *highSeverityQuery = nil;
+    if (self.highSeverityFileLogger)
+    {
+        highSeverityQuery = [query copy];
+        NSDate *oldestDate = [self.fileLogger.logFileManager sortedLogFileInfos].lastObject.creationDate;
+        if (oldestDate && (!highSeverityQuery.endDate || [oldestDate compare:highSeverityQuery.endDate] == NSOrderedAscending))
+        {
+            highSeverityQuery.endDate = oldestDate;
+        }
+    }
+
+    //Each file logger's files are searched at once, and the completion called when all of them have been
+    dispatch_group_t group = dispatch_group_create();
+    for (DDFileLogger *fileLogger in fileLoggers)
+    {
+        SproutLogQueryEngine *logQueryEngine = [self logQueryEngineForLogFileManager:fileLogger.logFileManager];
+        SproutLogQuery *fileLoggerQuery = fileLogger == self.highSeverityFileLogger ? highSeverityQuery : query;
+        if (!logQueryEngine || (fileLoggerQuery.startDate && fileLoggerQuery.endDate && [fileLoggerQuery.startDate compare:fileLoggerQuery.endDate] != NSOrderedAscending))
+        {
+            continue;
+        }
+
+        dispatch_group_enter(group);
+        [logQueryEngine searchWithQuery:fileLoggerQuery resultsQueue:nil resultsHandler:resultsHandler completion:^{
+            dispatch_group_leave(group);
+        }];
+    }
+
+    if (completion)
+    {
+        dispatch_group_notify(group, dispatch_get_main_queue(), completion);
+    }
+}
+
+- (SproutLogQueryEngine *)logQueryEngineForLogFileManager:(id<DDLogFileManager>)logFileManager
+{
+    if (!logFileManager)
+    {
+        return nil;
+    }
+
+    //Searches may be started from any thread
+    @synchronized (self.logQueryEngines)
+    {
+        for (SproutLogQueryEngine *logQueryEngine in self.logQueryEngines)
+        {
+            if (logQueryEngine.logFileManager == logFileManager)
+            {
+                return logQueryEngine;
+            }
+        }
+
+        SproutLogQueryEngine *retVal = [[SproutLogQueryEngine alloc] initWithLogFileManager:logFileManager];
+        [self.logQueryEngines addObject:retVal];
+        return retVal;
+    }
 }
 
 #pragma mark - Logging Setup
@@ -343,7 +717,8 @@ void sproutSignalHandler(int signal)
 	if (logger)
 	{
 		self.fileLogger = logger;
-		[loggers addObject:logger];
+		self.fileLogRouter = [self setupFileLogRouterWithDefaultFileLogger:logger];
+		[loggers addObject:self.fileLogRouter ?: logger];
 	}
 	
     return loggers;
@@ -351,7 +726,13 @@ void sproutSignalHandler(int signal)
 
 - (void)addLogger:(id <DDLogger>)logger
 {
-    [self addLogger:logger withLogLevel:DDLogLevelAll];
+    NSNumber *logLevel = nil;
+    @synchronized (self.loggerLevels)
+    {
+        logLevel = [self.loggerLevels objectForKey:logger];
+    }
+
+    [self addLogger:logger withLogLevel:logLevel ? logLevel.unsignedIntegerValue : DDLogLevelAll];
 }
 
 - (void)addLogger:(id <DDLogger>)logger withLogLevel:(NSUInteger)logLevel
@@ -365,9 +746,42 @@ void sproutSignalHandler(int signal)
 			formatter = self.logFormatterBlock(formatter);
 		}
 
-		[logger setLogFormatter:formatter];
-        
-        [DDLog addLogger:logger];
+		if (self.redactor)
+		{
+			formatter = [[SproutStagedLogFormatter alloc] initWithStage:self.redactor formatter:formatter];
+		}
+
+		//Loggers with equivalent formatters share them, so each message is formatted once for all of them
+		formatter = [self sharedLogFormatterForLogFormatter:formatter];
+		SproutSharedLogFormatter *loggerFormatter = [[SproutSharedLogFormatter alloc] initWithLogFormatter:formatter];
+		[logger setLogFormatter:loggerFormatter];
+
+		@synchronized (self.loggerLevels)
+		{
+			[self.loggerLevels setObject:@(logLevel) forKey:logger];
+			[self.loggerFormatters setObject:loggerFormatter forKey:logger];
+			loggerFormatter.logLevel = (DDLogLevel)logLevel;
+		}
+
+		//The logger's level is applied by its formatter (before the message is formatted), rather than by CocoaLumberjack,
+		//which can only change the level of an installed logger by removing it and adding it back
+        [DDLog addLogger:logger withLevel:DDLogLevelAll];
+    }
+}
+
+- (void)setLogLevel:(NSUInteger)logLevel forLogger:(id <DDLogger>)logger
+{
+    if (!logger)
+    {
+        return;
+    }
+
+    //Loggers which have not been added yet get the level when they are added with `addLogger:`. Installed loggers stay
+    //installed, so no messages are lost and no log files are rolled.
+    @synchronized (self.loggerLevels)
+    {
+        [self.loggerLevels setObject:@(logLevel) forKey:logger];
+        [self.loggerFormatters objectForKey:logger].logLevel = (DDLogLevel)logLevel;
     }
 }
 
@@ -404,16 +818,93 @@ void sproutSignalHandler(int signal)
     
     #if SPROUT_FILE_LOGGING
     //File logging
-    logger = [[DDFileLogger alloc] init];
-    logger.rollingFrequency = 60 * 60 * 24; // 24 hour rolling
-    logger.logFileManager.maximumNumberOfLogFiles = 7;
+    SproutLogFileManager *logFileManager = [[SproutLogFileManager alloc] init];
+    logger = [[DDFileLogger alloc] initWithLogFileManager:logFileManager];
+    if (self.tieredFileLogging)
+    {
+        //All messages, for a few hours
+        logger.rollingFrequency = kTieredLowSeverityRollingFrequency;
+        logFileManager.maximumNumberOfLogFiles = 0;
+        logFileManager.maximumFileAge = kTieredLowSeverityMaximumFileAge;
+
+        //Errors and warnings, for a month
+        NSString *highSeverityLogsDirectory = [logFileManager.logsDirectory stringByAppendingPathComponent:kHighSeverityLogsDirectoryName];
+        SproutLogFileManager *highSeverityLogFileManager = [[SproutLogFileManager alloc] initWithLogsDirectory:highSeverityLogsDirectory];
+        highSeverityLogFileManager.maximumNumberOfLogFiles = 0;
+        highSeverityLogFileManager.maximumFileAge = kTieredHighSeverityMaximumFileAge;
+        self.highSeverityFileLogger = [[DDFileLogger alloc] initWithLogFileManager:highSeverityLogFileManager];
+        self.highSeverityFileLogger.rollingFrequency = kTieredHighSeverityRollingFrequency;
+    }
+    else
+    {
+        logger.rollingFrequency = 60 * 60 * 24; // 24 hour rolling
+        logFileManager.maximumNumberOfLogFiles = 7;
+    }
     #endif
 
     return logger;
 }
 
+- (SproutFileLogRouter *)setupFileLogRouterWithDefaultFileLogger:(DDFileLogger *)defaultFileLogger
+{
+    SproutFileLogRouter *router = nil;
+
+    if (self.contextFileLoggers.count > 0 || self.highSeverityFileLogger)
+    {
+        router = [[SproutFileLogRouter alloc] initWithDefaultFileLogger:defaultFileLogger];
+        [self.contextFileLoggers enumerateKeysAndObjectsUsingBlock:^(NSNumber *context, DDFileLogger *fileLogger, BOOL *stop) {
+            [router setFileLogger:fileLogger forContext:context.integerValue];
+        }];
+
+        if (self.highSeverityFileLogger)
+        {
+            [router addFileLogger:self.highSeverityFileLogger forFlags:DDLogFlagError | DDLogFlagWarning];
+        }
+    }
+
+    return router;
+}
+
+- (void)setFileLogger:(DDFileLogger *)fileLogger forContext:(NSInteger)context
+{
+    if (self.started)
+    {
+        SproutLogWarn(@"File loggers must be set before 'startLogging'. Ignoring file logger for context %ld.", (long)context);
+        return;
+    }
+
+    self.contextFileLoggers[@(context)] = fileLogger;
+}
+
 #pragma mark - Helpers
 
+- (id<DDLogFormatter>)sharedLogFormatterForLogFormatter:(id<DDLogFormatter>)formatter
+{
+    id<DDLogFormatter> retVal = formatter;
+
+    if (formatter)
+    {
+        @synchronized (self.sharedLogFormatters)
+        {
+            for (id<DDLogFormatter> sharedLogFormatter in self.sharedLogFormatters)
+            {
+                if (SproutLogFormattersAreEquivalent(sharedLogFormatter, formatter))
+                {
+                    retVal = sharedLogFormatter;
+                    break;
+                }
+            }
+
+            if (retVal == formatter)
+            {
+                [self.sharedLogFormatters addObject:formatter];
+            }
+        }
+    }
+
+    return retVal;
+}
+
 - (void)addStartupMessageBlock:(void (^__nonnull)(void))messageBlock
 {
 	if (messageBlock)
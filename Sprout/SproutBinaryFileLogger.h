@@ -0,0 +1,46 @@
+//
+//  SproutBinaryFileLogger.h
+//
+//  Part of "Sprout" https://github.com/levigroker/Sprout
+//
+//  Created on October 19, 2026.
+//  Copyright (c) 2026 Levi Brown <mailto:levigroker@gmail.com> This work is
+//  licensed under the Creative Commons Attribution 4.0 International License. To
+//  view a copy of this license, visit https://creativecommons.org/licenses/by/4.0/
+//  or send a letter to Creative Commons, PO Box 1866, Mountain View, CA 94042, USA.
+//
+//  The above attribution and the included license must accompany any version of
+//  the source code, binary distributable, or derivatives.
+//
+
+#import <Foundation/Foundation.h>
+#import <CocoaLumberjack/CocoaLumberjack.h>
+
+/**
+ The file extension used for binary log files.
+ */
+extern NSString * const SproutBinaryLogFileExtension;
+
+/**
+ A `DDFileLogger` which writes a compact binary log format (see SproutBinaryLogFormat.h) rather than text.
+
+ The call site (file, function, line, level and context) and thread of a message are written to the file once, the first
+ time they are seen, and later messages refer to them by a small id. Each message record then only holds a varint
+ timestamp delta, the call site and thread ids, and the message text, which is far smaller (and cheaper to write) than
+ the two lines of text `SproutCustomLogFormatter` writes.
+
+ The `sproutlog` command line tool (in the Tools directory of the repository) renders binary log files back into the
+ `SproutCustomLogFormatter` text format.
+
+ Note that the log formatter does not format the messages, since the file does not hold formatted text, but its stages
+ (i.e. Sprout's `redactor`, see `SproutStagedLogFormatter`) are still run on each message before it is written.
+ */
+@interface SproutBinaryFileLogger : DDFileLogger
+
+/**
+ Creates a binary file logger with a `SproutLogFileManager` using the default logs directory and the
+ `SproutBinaryLogFileExtension`.
+ */
+- (instancetype)init;
+
+@end
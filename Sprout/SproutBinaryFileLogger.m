@@ -0,0 +1,306 @@
+//
+//  SproutBinaryFileLogger.m
+//
+//  Part of "Sprout" https://github.com/levigroker/Sprout
+//
+//  Created on October 19, 2026.
+//  Copyright (c) 2026 Levi Brown <mailto:levigroker@gmail.com> This work is
+//  licensed under the Creative Commons Attribution 4.0 International License. To
+//  view a copy of this license, visit https://creativecommons.org/licenses/by/4.0/
+//  or send a letter to Creative Commons, PO Box 1866, Mountain View, CA 94042, USA.
+//
+//  The above attribution and the included license must accompany any version of
+//  the source code, binary distributable, or derivatives.
+//
+
+#include <math.h>
+#include <string.h>
+
+#import "SproutBinaryFileLogger.h"
+#import "SproutBinaryLogFormat.h"
+#import "SproutLogFileManager.h"
+#import "SproutLogFields.h"
+#import "SproutStagedLogFormatter.h"
+
+NSString * const SproutBinaryLogFileExtension = @"logb";
+
+//`DDFileLogger` internals (see DDFileLogger+Internal.h, which CocoaLumberjack does not make public)
+@interface DDFileLogger (SproutBinaryFileLogger)
+
+- (void)lt_logData:(NSData *)data;
+- (void)lt_rollLogFileNow;
+
+@end
+
+static void sproutAppendVarint(NSMutableData *data, uint64_t value)
+{
+    uint8_t buffer[SPROUT_VARINT_MAX_LENGTH];
+    [data appendBytes:buffer length:sproutVarintEncode(value, buffer)];
+}
+
+static void sproutAppendString(NSMutableData *data, NSString *string)
+{
+    const char *utf8 = string.UTF8String ?: "";
+    size_t length = strlen(utf8);
+    sproutAppendVarint(data, length);
+    [data appendBytes:utf8 length:length];
+}
+
+static void sproutAppendFields(NSMutableData *data, SproutLogFields *fields)
+{
+    if (fields.count == 0)
+    {
+        return;
+    }
+
+    sproutAppendVarint(data, fields.count);
+    for (NSUInteger i = 0; i < fields.count; ++i)
+    {
+        sproutAppendString(data, [fields keyAtIndex:i]);
+
+        SproutLogFieldType fieldType = [fields typeAtIndex:i];
+        uint8_t type = (uint8_t)fieldType;
+        [data appendBytes:&type length:1];
+
+        switch (fieldType)
+        {
+            case SproutLogFieldTypeInteger:
+                sproutAppendVarint(data, sproutZigzagEncode([fields integerValueAtIndex:i]));
+                break;
+            case SproutLogFieldTypeUnsigned:
+                sproutAppendVarint(data, [fields unsignedValueAtIndex:i]);
+                break;
+            case SproutLogFieldTypeDouble:
+            {
+                double value = [fields doubleValueAtIndex:i];
+                uint64_t bits;
+                memcpy(&bits, &value, sizeof(bits));
+                uint8_t bytes[8];
+                for (int b = 0; b < 8; ++b)
+                {
+                    bytes[b] = (uint8_t)(bits >> (8 * b));
+                }
+                [data appendBytes:bytes length:sizeof(bytes)];
+                break;
+            }
+            case SproutLogFieldTypeBool:
+            {
+                uint8_t value = [fields boolValueAtIndex:i] ? 1 : 0;
+                [data appendBytes:&value length:1];
+                break;
+            }
+            case SproutLogFieldTypeObject:
+            {
+                id object = [fields objectValueAtIndex:i];
+                sproutAppendString(data, [object isKindOfClass:[NSString class]] ? object : [object description]);
+                break;
+            }
+        }
+    }
+}
+
+static void sproutAppendRecord(NSMutableData *data, SproutBinaryLogRecordType type, NSData *payload)
+{
+    uint8_t recordType = (uint8_t)type;
+    [data appendBytes:&recordType length:1];
+    sproutAppendVarint(data, payload.length);
+    [data appendData:payload];
+}
+
+static inline int64_t sproutTimestampMilliseconds(NSDate *date)
+{
+    return (int64_t)llround(date.timeIntervalSince1970 * 1000.0);
+}
+
+#pragma mark - SproutBinaryCallSite
+
+//Identifies a call site, for looking up its id
+@interface SproutBinaryCallSite : NSObject <NSCopying>
+{
+    @public
+    NSString *_file;
+    NSString *_function;
+    NSUInteger _line;
+    DDLogFlag _flag;
+    NSInteger _context;
+}
+
+@end
+
+@implementation SproutBinaryCallSite
+
+- (NSUInteger)hash
+{
+    return _function.hash ^ (_line * 31) ^ ((NSUInteger)_flag << 24) ^ (NSUInteger)_context;
+}
+
+- (BOOL)isEqual:(id)object
+{
+    if (![object isKindOfClass:[SproutBinaryCallSite class]])
+    {
+        return NO;
+    }
+
+    SproutBinaryCallSite *other = object;
+    return _line == other->_line && _flag == other->_flag && _context == other->_context
+        && (_function == other->_function || [_function isEqualToString:other->_function])
+        && (_file == other->_file || [_file isEqualToString:other->_file]);
+}
+
+- (id)copyWithZone:(NSZone *)zone
+{
+    //Immutable once used as a key
+    return self;
+}
+
+@end
+
+#pragma mark - SproutBinaryFileLogger
+
+@interface SproutBinaryFileLogger ()
+{
+    //Only accessed on the logger queue
+    BOOL _needsSegment;
+    int64_t _lastTimestamp;
+    NSMutableDictionary<SproutBinaryCallSite *, NSNumber *> *_callSiteIDs;
+    NSMutableDictionary<NSString *, NSNumber *> *_threadIDs;
+    NSMutableData *_payload;
+    NSMutableData *_output;
+}
+
+@end
+
+@implementation SproutBinaryFileLogger
+
+- (instancetype)init
+{
+    SproutLogFileManager *logFileManager = [[SproutLogFileManager alloc] init];
+    logFileManager.logFileExtension = SproutBinaryLogFileExtension;
+
+    return [self initWithLogFileManager:logFileManager];
+}
+
+- (instancetype)initWithLogFileManager:(id<DDLogFileManager>)logFileManager completionQueue:(dispatch_queue_t)dispatchQueue
+{
+    if ((self = [super initWithLogFileManager:logFileManager completionQueue:dispatchQueue]))
+    {
+        _needsSegment = YES;
+        _callSiteIDs = [[NSMutableDictionary alloc] init];
+        _threadIDs = [[NSMutableDictionary alloc] init];
+        _payload = [[NSMutableData alloc] init];
+        _output = [[NSMutableData alloc] init];
+    }
+
+    return self;
+}
+
+#pragma mark DDFileLogger
+
+- (void)logMessage:(DDLogMessage *)logMessage
+{
+    if (!SproutLogFormatterAcceptsLogMessage(_logFormatter, logMessage))
+    {
+        return;
+    }
+
+    //The messages are written rather than formatted, but still go through the formatter's stages (i.e. redaction)
+    logMessage = SproutLogMessageProcessedForLogFormatter(logMessage, _logFormatter);
+
+    _output.length = 0;
+
+    int64_t timestamp = sproutTimestampMilliseconds(logMessage->_timestamp);
+
+    if (_needsSegment)
+    {
+        [self lt_appendSegmentWithTimestamp:timestamp];
+    }
+
+    uint64_t callSiteID = [self lt_callSiteIDForLogMessage:logMessage];
+    uint64_t threadID = [self lt_threadIDForLogMessage:logMessage];
+
+    _payload.length = 0;
+    sproutAppendVarint(_payload, sproutZigzagEncode(timestamp - _lastTimestamp));
+    sproutAppendVarint(_payload, callSiteID);
+    sproutAppendVarint(_payload, threadID);
+    sproutAppendString(_payload, logMessage->_message);
+    sproutAppendFields(_payload, SproutLogMessageFields(logMessage));
+    sproutAppendRecord(_output, SproutBinaryLogRecordTypeMessage, _payload);
+    _lastTimestamp = timestamp;
+
+    [self lt_logData:_output];
+}
+
+- (void)lt_rollLogFileNow
+{
+    [super lt_rollLogFileNow];
+
+    //The next file starts afresh
+    _needsSegment = YES;
+}
+
+#pragma mark Helpers
+
+- (void)lt_appendSegmentWithTimestamp:(int64_t)timestamp
+{
+    [_callSiteIDs removeAllObjects];
+    [_threadIDs removeAllObjects];
+    _lastTimestamp = timestamp;
+    _needsSegment = NO;
+
+    uint8_t version = SPROUT_BINARY_LOG_VERSION;
+    _payload.length = 0;
+    [_payload appendBytes:SPROUT_BINARY_LOG_MAGIC length:SPROUT_BINARY_LOG_MAGIC_LENGTH];
+    [_payload appendBytes:&version length:1];
+    sproutAppendVarint(_payload, (uint64_t)timestamp);
+    sproutAppendRecord(_output, SproutBinaryLogRecordTypeSegment, _payload);
+}
+
+- (uint64_t)lt_callSiteIDForLogMessage:(DDLogMessage *)logMessage
+{
+    SproutBinaryCallSite *callSite = [[SproutBinaryCallSite alloc] init];
+    callSite->_file = logMessage->_file ?: @"";
+    callSite->_function = logMessage->_function ?: @"";
+    callSite->_line = logMessage->_line;
+    callSite->_flag = logMessage->_flag;
+    callSite->_context = logMessage->_context;
+
+    NSNumber *retVal = _callSiteIDs[callSite];
+    if (!retVal)
+    {
+        retVal = @(_callSiteIDs.count);
+        _callSiteIDs[callSite] = retVal;
+
+        uint8_t flag = (uint8_t)logMessage->_flag;
+        _payload.length = 0;
+        sproutAppendVarint(_payload, retVal.unsignedLongLongValue);
+        [_payload appendBytes:&flag length:1];
+        sproutAppendVarint(_payload, sproutZigzagEncode(logMessage->_context));
+        sproutAppendVarint(_payload, logMessage->_line);
+        sproutAppendString(_payload, callSite->_file.lastPathComponent);
+        sproutAppendString(_payload, callSite->_function);
+        sproutAppendRecord(_output, SproutBinaryLogRecordTypeCallSite, _payload);
+    }
+
+    return retVal.unsignedLongLongValue;
+}
+
+- (uint64_t)lt_threadIDForLogMessage:(DDLogMessage *)logMessage
+{
+    NSString *thread = logMessage->_threadID ?: @"";
+
+    NSNumber *retVal = _threadIDs[thread];
+    if (!retVal)
+    {
+        retVal = @(_threadIDs.count);
+        _threadIDs[thread] = retVal;
+
+        _payload.length = 0;
+        sproutAppendVarint(_payload, retVal.unsignedLongLongValue);
+        sproutAppendString(_payload, thread);
+        sproutAppendRecord(_output, SproutBinaryLogRecordTypeThread, _payload);
+    }
+
+    return retVal.unsignedLongLongValue;
+}
+
+@end
@@ -0,0 +1,137 @@
+//
+//  SproutBinaryLogFormat.h
+//
+//  Part of "Sprout" https://github.com/levigroker/Sprout
+//
+//  Created on October 19, 2026.
+//  Copyright (c) 2026 Levi Brown <mailto:levigroker@gmail.com> This work is
+//  licensed under the Creative Commons Attribution 4.0 International License. To
+//  view a copy of this license, visit https://creativecommons.org/licenses/by/4.0/
+//  or send a letter to Creative Commons, PO Box 1866, Mountain View, CA 94042, USA.
+//
+//  The above attribution and the included license must accompany any version of
+//  the source code, binary distributable, or derivatives.
+//
+
+/**
+ The binary log file format written by `SproutBinaryFileLogger`.
+ This header is plain C, so it can be shared with the `sproutlog` decoder in the Tools directory.
+
+ A log file is a sequence of records. Every record is framed the same way:
+
+     type      uint8
+     length    varint (the number of payload bytes which follow)
+     payload   `length` bytes
+
+ so a reader can skip records it doesn't understand, and a file which ends part way through a record (i.e. the app crashed
+ while writing it) is read up to the last complete record.
+
+ Varints are unsigned LEB128. Signed values are zigzag encoded first. Strings are a varint byte count followed by
+ that many UTF-8 bytes.
+
+ Records:
+
+     SEGMENT   magic "SPBL", version uint8, timestamp varint (milliseconds since 1970)
+               Starts a segment. The string tables and the running timestamp are reset. Every file starts with a segment,
+               and another is started each time the app resumes writing to an existing file.
+     CALLSITE  id varint, flag uint8, context zigzag varint, line varint, file string, function string
+               Defines a call site (id values count up from zero within a segment).
+     THREAD    id varint, thread string
+               Defines a thread id (id values count up from zero within a segment).
+     MESSAGE   timestamp delta zigzag varint (milliseconds since the previous SEGMENT or MESSAGE), call site id varint,
+               thread id varint, message string, and optionally the message's key/value fields: count varint, then for
+               each field a key string, a type uint8 and a value:
+
+                   INTEGER   zigzag varint
+                   UNSIGNED  varint
+                   DOUBLE    8 bytes (little endian IEEE 754)
+                   BOOL      uint8
+                   STRING    string
+ */
+
+#ifndef _SPROUT_BINARY_LOG_FORMAT_H
+#define _SPROUT_BINARY_LOG_FORMAT_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#define SPROUT_BINARY_LOG_MAGIC "SPBL"
+#define SPROUT_BINARY_LOG_MAGIC_LENGTH 4
+#define SPROUT_BINARY_LOG_VERSION 1
+
+//The longest varint encoding of a uint64_t
+#define SPROUT_VARINT_MAX_LENGTH 10
+
+typedef enum
+{
+    SproutBinaryLogRecordTypeSegment = 1,
+    SproutBinaryLogRecordTypeCallSite = 2,
+    SproutBinaryLogRecordTypeThread = 3,
+    SproutBinaryLogRecordTypeMessage = 4,
+} SproutBinaryLogRecordType;
+
+typedef enum
+{
+    SproutBinaryLogFieldTypeInteger = 1,
+    SproutBinaryLogFieldTypeUnsigned = 2,
+    SproutBinaryLogFieldTypeDouble = 3,
+    SproutBinaryLogFieldTypeBool = 4,
+    SproutBinaryLogFieldTypeString = 5,
+} SproutBinaryLogFieldType;
+
+//Values match `DDLogFlag`
+typedef enum
+{
+    SproutBinaryLogFlagError = 1 << 0,
+    SproutBinaryLogFlagWarning = 1 << 1,
+    SproutBinaryLogFlagInfo = 1 << 2,
+    SproutBinaryLogFlagDebug = 1 << 3,
+    SproutBinaryLogFlagVerbose = 1 << 4,
+} SproutBinaryLogFlag;
+
+/**
+ Writes the varint encoding of `value` to `buffer`, which must have room for `SPROUT_VARINT_MAX_LENGTH` bytes.
+ @return The number of bytes written.
+ */
+static inline size_t sproutVarintEncode(uint64_t value, uint8_t *buffer)
+{
+    size_t retVal = 0;
+    while (value >= 0x80)
+    {
+        buffer[retVal++] = (uint8_t)(value | 0x80);
+        value >>= 7;
+    }
+    buffer[retVal++] = (uint8_t)value;
+    return retVal;
+}
+
+/**
+ Reads a varint from the `length` bytes at `buffer`.
+ @return The number of bytes read, or zero if the bytes do not hold a complete varint.
+ */
+static inline size_t sproutVarintDecode(const uint8_t *buffer, size_t length, uint64_t *value)
+{
+    uint64_t result = 0;
+    for (size_t i = 0; i < length && i < SPROUT_VARINT_MAX_LENGTH; ++i)
+    {
+        result |= (uint64_t)(buffer[i] & 0x7F) << (7 * i);
+        if (!(buffer[i] & 0x80))
+        {
+            *value = result;
+            return i + 1;
+        }
+    }
+    return 0;
+}
+
+static inline uint64_t sproutZigzagEncode(int64_t value)
+{
+    return ((uint64_t)value << 1) ^ (uint64_t)(value >> 63);
+}
+
+static inline int64_t sproutZigzagDecode(uint64_t value)
+{
+    return (int64_t)(value >> 1) ^ -(int64_t)(value & 1);
+}
+
+#endif /* _SPROUT_BINARY_LOG_FORMAT_H */
@@ -0,0 +1,91 @@
+//
+//  SproutCLog.h
+//
+//  Part of "Sprout" https://github.com/levigroker/Sprout
+//
+//  Created on October 19, 2026.
+//  Copyright (c) 2026 Levi Brown <mailto:levigroker@gmail.com> This work is
+//  licensed under the Creative Commons Attribution 4.0 International License. To
+//  view a copy of this license, visit https://creativecommons.org/licenses/by/4.0/
+//  or send a letter to Creative Commons, PO Box 1866, Mountain View, CA 94042, USA.
+//
+//  The above attribution and the included license must accompany any version of
+//  the source code, binary distributable, or derivatives.
+//
+
+/**
+ A logging API for plain C translation units (which can't import `Sprout.h`), such as C libraries:
+
+     #include "SproutCLog.h"
+
+     sprout_log(SPROUT_LOG_FLAG_DEBUG, 0, "Decoded %zu frames in %.2fms", count, milliseconds);
+
+ The level check is inline, and is the same as that of the `DDLog...` macros (see SproutLogLevels.h), so per-context and
+ per-module levels apply. An enabled statement is formatted with `vsnprintf` into a buffer on the caller's stack, and the
+ bytes are copied into the message, which only makes them into a string when a logger first reads it (on the logger's
+ queue). So no format string object is made and the message isn't formatted a second time.
+ Statements with `SPROUT_LOG_FLAG_ERROR` are logged synchronously, as `DDLogError` is.
+
+ Unlike `SPROUT_LOG_C_MACRO`, the format is a C string with `printf` conversions, checked by the compiler (so `%@` is not
+ supported). Log call sites (see SproutLogCallSites.h) and `SPROUT_MODULE_MAX_LEVEL` don't apply to these statements.
+ */
+
+#ifndef _SPROUT_C_LOG_H
+#define _SPROUT_C_LOG_H
+
+#include <stdarg.h>
+#include <stdint.h>
+
+#include "SproutLogLevels.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+//Values match `DDLogFlag`
+#define SPROUT_LOG_FLAG_ERROR   (1u << 0)
+#define SPROUT_LOG_FLAG_WARNING (1u << 1)
+#define SPROUT_LOG_FLAG_INFO    (1u << 2)
+#define SPROUT_LOG_FLAG_DEBUG   (1u << 3)
+#define SPROUT_LOG_FLAG_VERBOSE (1u << 4)
+
+//Messages formatted to at most this many bytes (excluding the terminator) don't need a heap allocation
+#define SPROUT_LOG_C_BUFFER_LENGTH 1023
+
+/**
+ Formats and logs a message, whatever the log level. Use `sprout_log`, which checks the level first.
+ The file and function must have static storage (i.e. `__FILE__` and `__func__`), as their strings are made once and kept.
+ */
+void sprout_log_message(uint32_t flag, intptr_t context, const char *file, const char *function, unsigned int line, const char *format, ...)
+    __attribute__((cold, noinline, format(printf, 6, 7)));
+
+/**
+ As `sprout_log_message`, with a `va_list`.
+ */
+void sprout_log_messagev(uint32_t flag, intptr_t context, const char *file, const char *function, unsigned int line, const char *format, va_list args)
+    __attribute__((cold, noinline, format(printf, 6, 0)));
+
+/**
+ Logs a `printf` style message with the given flag (i.e. `SPROUT_LOG_FLAG_INFO`) and context, if the log levels allow it.
+ The arguments are only evaluated if the statement is logged.
+ */
+#define sprout_log(flag, context, format, ...)                                                                  \
+        do                                                                                                      \
+        {                                                                                                       \
+            if (SproutLogLevelIsEnabled(SproutLogLevelCurrent(), (flag), (context), SPROUT_LOG_MODULE))          \
+            {                                                                                                   \
+                sprout_log_message((flag), (context), __FILE__, __func__, __LINE__, (format), ## __VA_ARGS__);  \
+            }                                                                                                   \
+        } while (0)
+
+#define sprout_log_error(context, format, ...)   sprout_log(SPROUT_LOG_FLAG_ERROR, context, format, ## __VA_ARGS__)
+#define sprout_log_warn(context, format, ...)    sprout_log(SPROUT_LOG_FLAG_WARNING, context, format, ## __VA_ARGS__)
+#define sprout_log_info(context, format, ...)    sprout_log(SPROUT_LOG_FLAG_INFO, context, format, ## __VA_ARGS__)
+#define sprout_log_debug(context, format, ...)   sprout_log(SPROUT_LOG_FLAG_DEBUG, context, format, ## __VA_ARGS__)
+#define sprout_log_verbose(context, format, ...) sprout_log(SPROUT_LOG_FLAG_VERBOSE, context, format, ## __VA_ARGS__)
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _SPROUT_C_LOG_H */
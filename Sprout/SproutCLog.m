@@ -0,0 +1,66 @@
+//
+//  SproutCLog.m
+//
+//  Part of "Sprout" https://github.com/levigroker/Sprout
+//
+//  Created on October 19, 2026.
+//  Copyright (c) 2026 Levi Brown <mailto:levigroker@gmail.com> This work is
+//  licensed under the Creative Commons Attribution 4.0 International License. To
+//  view a copy of this license, visit https://creativecommons.org/licenses/by/4.0/
+//  or send a letter to Creative Commons, PO Box 1866, Mountain View, CA 94042, USA.
+//
+//  The above attribution and the included license must accompany any version of
+//  the source code, binary distributable, or derivatives.
+//
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#import "SproutCLog.h"
+#import "SproutLogArguments.h"
+
+void sprout_log_message(uint32_t flag, intptr_t context, const char *file, const char *function, unsigned int line, const char *format, ...)
+{
+    va_list args;
+    va_start(args, format);
+    sprout_log_messagev(flag, context, file, function, line, format, args);
+    va_end(args);
+}
+
+void sprout_log_messagev(uint32_t flag, intptr_t context, const char *file, const char *function, unsigned int line, const char *format, va_list args)
+{
+    char stackBuffer[SPROUT_LOG_C_BUFFER_LENGTH + 1];
+    char *buffer = stackBuffer;
+
+    va_list argsCopy;
+    va_copy(argsCopy, args);
+    int length = vsnprintf(stackBuffer, sizeof(stackBuffer), format, argsCopy);
+    va_end(argsCopy);
+
+    if (length < 0)
+    {
+        return;
+    }
+
+    if ((size_t)length >= sizeof(stackBuffer))
+    {
+        //Too long for the stack buffer, so format it again into one which fits
+        buffer = malloc((size_t)length + 1);
+        if (!buffer)
+        {
+            return;
+        }
+        vsnprintf(buffer, (size_t)length + 1, format, args);
+    }
+
+    @autoreleasepool
+    {
+        //The bytes are copied into the message, and only made into a string on the logger's queue
+        SproutLogTextLog(flag, context, file, function, line, buffer, (size_t)length);
+    }
+
+    if (buffer != stackBuffer)
+    {
+        free(buffer);
+    }
+}
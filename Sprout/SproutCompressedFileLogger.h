@@ -0,0 +1,73 @@
+//
+//  SproutCompressedFileLogger.h
+//
+//  Part of "Sprout" https://github.com/levigroker/Sprout
+//
+//  Created on October 19, 2026.
+//  Copyright (c) 2026 Levi Brown <mailto:levigroker@gmail.com> This work is
+//  licensed under the Creative Commons Attribution 4.0 International License. To
+//  view a copy of this license, visit https://creativecommons.org/licenses/by/4.0/
+//  or send a letter to Creative Commons, PO Box 1866, Mountain View, CA 94042, USA.
+//
+//  The above attribution and the included license must accompany any version of
+//  the source code, binary distributable, or derivatives.
+//
+
+#import <Foundation/Foundation.h>
+#import <CocoaLumberjack/CocoaLumberjack.h>
+
+/**
+ The file extension used for compressed log files.
+ */
+extern NSString * const SproutCompressedLogFileExtension;
+
+/**
+ A `DDFileLogger` which writes its log files compressed, as they are written (rather than after they are rolled).
+
+ Formatted log messages are collected in memory and written as independently decodable compressed frames of (up to)
+ 64 KB of log output each. A frame is also written whenever an error is logged, whenever the logger is flushed
+ (i.e. `[DDLog flushLog]`), when the log file is rolled and when the logger is removed, so a crash loses at most the
+ messages logged since the last error, and never the error itself (i.e. the exception or signal Sprout logs as it dies).
+
+ Each frame is a 16 byte header (the magic "SPZ1", followed by the compressed length, the uncompressed length and the
+ CRC-32 of the uncompressed data, each a little endian `uint32_t`) followed by the raw deflate (RFC 1951) compressed data.
+ Use `SproutCompressedLogDecoder` to read the files back.
+
+ Note that `maximumFileSize` applies to the compressed size of the log file.
+ */
+@interface SproutCompressedFileLogger : DDFileLogger
+
+/**
+ Creates a compressed file logger with a `SproutLogFileManager` using the default logs directory and the
+ `SproutCompressedLogFileExtension`.
+ */
+- (instancetype)init;
+
+@end
+
+/**
+ Decodes log files written by `SproutCompressedFileLogger`.
+ */
+@interface SproutCompressedLogDecoder : NSObject
+
+/**
+ Decodes compressed log data.
+ Data which ends part way through a frame (i.e. a log file which was being written when the app crashed) decodes up to the
+ last complete frame. Corrupt frames are skipped.
+
+ @param data The compressed log data.
+ @param truncated If not `NULL`, set to `YES` if the data ended part way through a frame, or any corrupt frames were skipped.
+ @return The decoded log text.
+ */
++ (NSData *)decodeData:(NSData *)data truncated:(BOOL *)truncated;
+
+/**
+ Decodes the compressed log file at the given path. See `decodeData:truncated:`.
+
+ @param path The path of the compressed log file.
+ @param error Set if the file could not be read.
+ @return The decoded log text, or `nil` if the file could not be read.
+ */
++ (NSData *)decodeFileAtPath:(NSString *)path error:(NSError **)error;
+
+@end
@@ -0,0 +1,288 @@
+//
+//  SproutCompressedFileLogger.m
+//
+//  Part of "Sprout" https://github.com/levigroker/Sprout
+//
+//  Created on October 19, 2026.
+//  Copyright (c) 2026 Levi Brown <mailto:levigroker@gmail.com> This work is
+//  licensed under the Creative Commons Attribution 4.0 International License. To
+//  view a copy of this license, visit https://creativecommons.org/licenses/by/4.0/
+//  or send a letter to Creative Commons, PO Box 1866, Mountain View, CA 94042, USA.
+//
+//  The above attribution and the included license must accompany any version of
+//  the source code, binary distributable, or derivatives.
+//
+
+#include <string.h>
+#include <zlib.h>
+
+#import "SproutCompressedFileLogger.h"
+#import "SproutLogFileManager.h"
+
+NSString * const SproutCompressedLogFileExtension = @"logz";
+
+static uint8_t const kSproutFrameMagic[4] = { 'S', 'P', 'Z', '1' };
+static size_t const kSproutFrameHeaderLength = 16;
+//Uncompressed log output per frame
+static NSUInteger const kSproutFrameLength = 64 * 1024;
+//Frames claiming to be larger than this are treated as corrupt
+static uint32_t const kSproutMaximumFrameLength = 16 * 1024 * 1024;
+
+//`DDFileLogger` internals (see DDFileLogger+Internal.h, which CocoaLumberjack does not make public)
+@interface DDFileLogger (SproutCompressedFileLogger)
+
+- (void)lt_logData:(NSData *)data;
+- (NSData *)lt_dataForMessage:(DDLogMessage *)logMessage;
+- (void)lt_flush;
+- (void)lt_rollLogFileNow;
+
+@end
+
+static inline void sproutWriteUInt32(uint8_t *p, uint32_t value)
+{
+    p[0] = (uint8_t)value;
+    p[1] = (uint8_t)(value >> 8);
+    p[2] = (uint8_t)(value >> 16);
+    p[3] = (uint8_t)(value >> 24);
+}
+
+static inline uint32_t sproutReadUInt32(const uint8_t *p)
+{
+    return (uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+#pragma mark - SproutCompressedFileLogger
+
+@interface SproutCompressedFileLogger ()
+{
+    //Only accessed on the logger queue
+    NSMutableData *_pendingData;
+    z_stream _stream;
+    BOOL _streamInitialized;
+}
+
+@end
+
+@implementation SproutCompressedFileLogger
+
+- (instancetype)init
+{
+    SproutLogFileManager *logFileManager = [[SproutLogFileManager alloc] init];
+    logFileManager.logFileExtension = SproutCompressedLogFileExtension;
+
+    return [self initWithLogFileManager:logFileManager];
+}
+
+- (instancetype)initWithLogFileManager:(id<DDLogFileManager>)logFileManager completionQueue:(dispatch_queue_t)dispatchQueue
+{
+    if ((self = [super initWithLogFileManager:logFileManager completionQueue:dispatchQueue]))
+    {
+        _pendingData = [[NSMutableData alloc] initWithCapacity:kSproutFrameLength];
+    }
+
+    return self;
+}
+
+- (void)dealloc
+{
+    if (_streamInitialized)
+    {
+        deflateEnd(&_stream);
+    }
+}
+
+#pragma mark DDFileLogger
+
+- (void)logMessage:(DDLogMessage *)logMessage
+{
+    NSData *data = [self lt_dataForMessage:logMessage];
+    if (data.length == 0)
+    {
+        return;
+    }
+
+    [_pendingData appendData:data];
+    //Errors are written at once, as they may be the last thing logged before the app dies (i.e. by Sprout's exception and
+    //signal handlers, which log synchronously)
+    if (_pendingData.length >= kSproutFrameLength || (logMessage->_flag & DDLogFlagError))
+    {
+        [self lt_writePendingFrame];
+    }
+}
+
+- (void)lt_flush
+{
+    [self lt_writePendingFrame];
+    [super lt_flush];
+}
+
+- (void)lt_rollLogFileNow
+{
+    //The pending log output belongs at the end of the file being rolled
+    [self lt_writePendingFrame];
+    [super lt_rollLogFileNow];
+}
+
+#pragma mark Helpers
+
+- (void)lt_writePendingFrame
+{
+    if (_pendingData.length == 0)
+    {
+        return;
+    }
+
+    NSData *frame = [self lt_frameForData:_pendingData];
+    //Cleared first, as writing the frame may roll the log file, which writes any pending frame.
+    _pendingData.length = 0;
+
+    if (frame)
+    {
+        [self lt_logData:frame];
+    }
+}
+
+- (NSData *)lt_frameForData:(NSData *)data
+{
+    if (!_streamInitialized)
+    {
+        //Negative window bits for a raw deflate stream (no zlib header or trailer)
+        if (deflateInit2(&_stream, Z_DEFAULT_COMPRESSION, Z_DEFLATED, -MAX_WBITS, 8, Z_DEFAULT_STRATEGY) != Z_OK)
+        {
+            return nil;
+        }
+        _streamInitialized = YES;
+    }
+    else
+    {
+        //Every frame is compressed independently, so it can be decoded on its own.
+        deflateReset(&_stream);
+    }
+
+    uLong bound = deflateBound(&_stream, (uLong)data.length);
+    NSMutableData *retVal = [NSMutableData dataWithLength:kSproutFrameHeaderLength + bound];
+    uint8_t *bytes = retVal.mutableBytes;
+
+    _stream.next_in = (Bytef *)data.bytes;
+    _stream.avail_in = (uInt)data.length;
+    _stream.next_out = bytes + kSproutFrameHeaderLength;
+    _stream.avail_out = (uInt)bound;
+
+    if (deflate(&_stream, Z_FINISH) != Z_STREAM_END)
+    {
+        return nil;
+    }
+
+    uint32_t compressedLength = (uint32_t)_stream.total_out;
+    memcpy(bytes, kSproutFrameMagic, sizeof(kSproutFrameMagic));
+    sproutWriteUInt32(bytes + 4, compressedLength);
+    sproutWriteUInt32(bytes + 8, (uint32_t)data.length);
+    sproutWriteUInt32(bytes + 12, (uint32_t)crc32(0, data.bytes, (uInt)data.length));
+    retVal.length = kSproutFrameHeaderLength + compressedLength;
+
+    return retVal;
+}
+
+@end
+
+#pragma mark - SproutCompressedLogDecoder
+
+@implementation SproutCompressedLogDecoder
+
++ (NSData *)decodeData:(NSData *)data truncated:(BOOL *)truncated
+{
+    NSMutableData *retVal = [NSMutableData data];
+    BOOL isTruncated = NO;
+
+    z_stream stream;
+    memset(&stream, 0, sizeof(stream));
+    if (inflateInit2(&stream, -MAX_WBITS) != Z_OK)
+    {
+        return nil;
+    }
+
+    const uint8_t *bytes = data.bytes;
+    size_t length = data.length;
+    size_t offset = 0;
+
+    while (offset < length)
+    {
+        if (length - offset < kSproutFrameHeaderLength)
+        {
+            isTruncated = YES;
+            break;
+        }
+
+        const uint8_t *header = bytes + offset;
+        uint32_t compressedLength = sproutReadUInt32(header + 4);
+        uint32_t frameLength = sproutReadUInt32(header + 8);
+        uint32_t checksum = sproutReadUInt32(header + 12);
+
+        BOOL valid = memcmp(header, kSproutFrameMagic, sizeof(kSproutFrameMagic)) == 0 && frameLength <= kSproutMaximumFrameLength;
+        if (valid && compressedLength > length - offset - kSproutFrameHeaderLength)
+        {
+            //The file ends part way through this frame
+            isTruncated = YES;
+            break;
+        }
+
+        if (valid)
+        {
+            NSUInteger decodedLength = retVal.length;
+            retVal.length = decodedLength + frameLength;
+
+            inflateReset(&stream);
+            stream.next_in = (Bytef *)(header + kSproutFrameHeaderLength);
+            stream.avail_in = compressedLength;
+            stream.next_out = (Bytef *)retVal.mutableBytes + decodedLength;
+            stream.avail_out = frameLength;
+
+            valid = inflate(&stream, Z_FINISH) == Z_STREAM_END
+                && stream.total_out == frameLength
+                && crc32(0, (const Bytef *)retVal.mutableBytes + decodedLength, frameLength) == checksum;
+
+            if (!valid)
+            {
+                retVal.length = decodedLength;
+            }
+        }
+
+        if (valid)
+        {
+            offset += kSproutFrameHeaderLength + compressedLength;
+        }
+        else
+        {
+            //Skip ahead to the next frame
+            isTruncated = YES;
+            const uint8_t *next = memmem(bytes + offset + 1, length - offset - 1, kSproutFrameMagic, sizeof(kSproutFrameMagic));
+            if (!next)
+            {
+                break;
+            }
+            offset = (size_t)(next - bytes);
+        }
+    }
+
+    inflateEnd(&stream);
+
+    if (truncated)
+    {
+        *truncated = isTruncated;
+    }
+
+    return retVal;
+}
+
++ (NSData *)decodeFileAtPath:(NSString *)path error:(NSError *__autoreleasing *)error
+{
+    NSData *data = [NSData dataWithContentsOfFile:path options:NSDataReadingMappedIfSafe error:error];
+    if (!data)
+    {
+        return nil;
+    }
+
+    return [self decodeData:data truncated:NULL];
+}
+
+@end
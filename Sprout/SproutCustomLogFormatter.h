@@ -13,9 +13,15 @@
 
 #import <Foundation/Foundation.h>
 #import <CocoaLumberjack/CocoaLumberjack.h>
+#import "SproutLogSanitizer.h"
+#import "SproutSharedLogFormatter.h"
 
-@interface SproutCustomLogFormatter : NSObject <DDLogFormatter>
+@interface SproutCustomLogFormatter : NSObject <SproutLogFormatterEquivalence>
 
 @property (nonatomic,strong) NSDateFormatter *dateFormatter;
+/**
+ If set, log messages are sanitized (i.e. multi-line messages are escaped or indented) before they are formatted.
+ */
+@property (nonatomic,strong) SproutLogSanitizer *messageSanitizer;
 
 @end
@@ -12,6 +12,7 @@
 //
 
 #import "SproutCustomLogFormatter.h"
+#import "SproutLogFields.h"
 
 @implementation SproutCustomLogFormatter
 
@@ -42,8 +43,39 @@
     NSString *function = logMessage->_function;
     NSString *timestamp = [self.dateFormatter stringFromDate:(logMessage->_timestamp)];
     NSString *threadID = logMessage->_threadID;
+    NSString *message = self.messageSanitizer ? [self.messageSanitizer sanitizeString:logMessage->_message] : logMessage->_message;
+    SproutLogFields *fields = SproutLogMessageFields(logMessage);
+    if (fields.count > 0)
+    {
+        message = [message stringByAppendingFormat:@" %@", fields.renderedString];
+    }
+    SproutDiagnosticContext *diagnosticContext = SproutLogMessageDiagnosticContext(logMessage);
+    if (diagnosticContext)
+    {
+        message = [message stringByAppendingFormat:@" {%@}", diagnosticContext.renderedString];
+    }
+
+	return [NSString stringWithFormat:@"%@         <%@> %@(%@ %d)\n%@ %@ %@", timestamp, threadID, function, file, (int)logMessage->_line, timestamp, logLevel, message];
+}
+
+#pragma mark SproutLogFormatterEquivalence
+
+- (BOOL)isEquivalentToLogFormatter:(id<DDLogFormatter>)formatter
+{
+    if (![formatter isMemberOfClass:[self class]])
+    {
+        return NO;
+    }
+
+    SproutCustomLogFormatter *other = (SproutCustomLogFormatter *)formatter;
+    NSDateFormatter *dateFormatter = self.dateFormatter;
+    NSDateFormatter *otherDateFormatter = other.dateFormatter;
+    BOOL sameDates = dateFormatter == otherDateFormatter
+        || ([dateFormatter.dateFormat isEqualToString:otherDateFormatter.dateFormat] && [dateFormatter.timeZone isEqual:otherDateFormatter.timeZone]
+            && [dateFormatter.locale isEqual:otherDateFormatter.locale] && [dateFormatter.calendar isEqual:otherDateFormatter.calendar]);
+    BOOL sameSanitizers = self.messageSanitizer == other.messageSanitizer || [self.messageSanitizer isEqual:other.messageSanitizer];
 
-	return [NSString stringWithFormat:@"%@         <%@> %@(%@ %d)\n%@ %@ %@", timestamp, threadID, function, file, (int)logMessage->_line, timestamp, logLevel, logMessage->_message];
+    return sameDates && sameSanitizers;
 }
 
 @end
@@ -0,0 +1,108 @@
+//
+//  SproutDiagnosticContext.h
+//
+//  Part of "Sprout" https://github.com/levigroker/Sprout
+//
+//  Created on October 19, 2026.
+//  Copyright (c) 2026 Levi Brown <mailto:levigroker@gmail.com> This work is
+//  licensed under the Creative Commons Attribution 4.0 International License. To
+//  view a copy of this license, visit https://creativecommons.org/licenses/by/4.0/
+//  or send a letter to Creative Commons, PO Box 1866, Mountain View, CA 94042, USA.
+//
+//  The above attribution and the included license must accompany any version of
+//  the source code, binary distributable, or derivatives.
+//
+
+#import <Foundation/Foundation.h>
+
+/**
+ A thread local mapped diagnostic context: key/value pairs (i.e. request ID, user session, screen) which are attached to
+ every message logged on the thread, so they don't have to be written into every log message.
+
+ Contexts are immutable. Pushing a value makes a new context (a copy of the current one, plus the value) the thread's
+ current context, so a log message captures the context by reference, for no more than the cost of reading the thread's
+ current context. The key/value pairs are only rendered to text when a formatter writes the message, and then only once
+ per context.
+
+ Messages capture the context via their `representedObject` (the `tag` of `LOG_MACRO`), so it is only captured by
+ messages logged without a tag of their own, from sources which import `Sprout.h` (see `SproutLogMacros.h`).
+
+ Example:
+
+     [SproutDiagnosticContext pushValue:requestID forKey:@"request"];
+     DDLogInfo(@"Loading"); //Formatted i.e. as "Loading {request=1234}"
+     [SproutDiagnosticContext pop];
+
+ Note that the context belongs to the thread: it does not follow work dispatched to other queues.
+ */
+@interface SproutDiagnosticContext : NSObject
+
+/**
+ The keys, in the order they were first pushed.
+ */
+@property (nonatomic, copy, readonly) NSArray<NSString *> *keys;
+
+/**
+ The context which was current when this one was pushed, or `nil`.
+ */
+@property (nonatomic, strong, readonly) SproutDiagnosticContext *parent;
+
+/**
+ @return The key/value pairs as text, i.e. `request=1234 screen=Settings`. Rendered once, when first asked for.
+ */
+@property (nonatomic, copy, readonly) NSString *renderedString;
+
+/**
+ @return The current thread's context, or `nil` if it has none.
+ */
++ (SproutDiagnosticContext *)currentContext;
+
+/**
+ Makes the given context the current thread's context (i.e. to carry a context captured on another thread over to a
+ dispatched block).
+
+ @param context The context. If `nil` the current thread's context is cleared.
+ */
++ (void)setCurrentContext:(SproutDiagnosticContext *)context;
+
+/**
+ Pushes a new context, with the given value added (or replaced), for the current thread.
+
+ @param value The value.
+ @param key The key.
+ */
++ (void)pushValue:(NSString *)value forKey:(NSString *)key;
+
+/**
+ Restores the context which was current before the last push on the current thread.
+ */
++ (void)pop;
+
+/**
+ Pushes the given value for the duration of the block, then restores the current context.
+
+ @param value The value.
+ @param key The key.
+ @param block The block to perform (synchronously).
+ */
++ (void)withValue:(NSString *)value forKey:(NSString *)key perform:(void (^NS_NOESCAPE)(void))block;
+
+/**
+ @param key The key.
+ @return The value for the key, or `nil` if the context has no value for it.
+ */
+- (NSString *)valueForContextKey:(NSString *)key;
+
+/**
+ @param block Processes a value (i.e. redacts it), returning the given value if there is nothing to change.
+ @return A context with the same keys (and parent) and the values processed by the block, or this context if it changed
+ nothing.
+ */
+- (SproutDiagnosticContext *)contextByProcessingValues:(NSString *(^NS_NOESCAPE)(NSString *value))block;
+
+@end
+
+/**
+ @return The current thread's diagnostic context, or `nil` if it has none. Used by `SproutLogMacros.h`.
+ */
+extern SproutDiagnosticContext *SproutDiagnosticContextCurrent(void);
@@ -0,0 +1,182 @@
+//
+//  SproutDiagnosticContext.m
+//
+//  Part of "Sprout" https://github.com/levigroker/Sprout
+//
+//  Created on October 19, 2026.
+//  Copyright (c) 2026 Levi Brown <mailto:levigroker@gmail.com> This work is
+//  licensed under the Creative Commons Attribution 4.0 International License. To
+//  view a copy of this license, visit https://creativecommons.org/licenses/by/4.0/
+//  or send a letter to Creative Commons, PO Box 1866, Mountain View, CA 94042, USA.
+//
+//  The above attribution and the included license must accompany any version of
+//  the source code, binary distributable, or derivatives.
+//
+
+#include <os/lock.h>
+#include <pthread.h>
+
+#import "SproutDiagnosticContext.h"
+
+static pthread_key_t sproutCurrentContextKey;
+
+static void sproutReleaseContext(void *context)
+{
+    if (context)
+    {
+        CFRelease(context);
+    }
+}
+
+static inline pthread_key_t sproutContextKey(void)
+{
+    static dispatch_once_t onceToken;
+    dispatch_once(&onceToken, ^{
+        pthread_key_create(&sproutCurrentContextKey, sproutReleaseContext);
+    });
+    return sproutCurrentContextKey;
+}
+
+SproutDiagnosticContext *SproutDiagnosticContextCurrent(void)
+{
+    return (__bridge SproutDiagnosticContext *)pthread_getspecific(sproutContextKey());
+}
+
+@interface SproutDiagnosticContext ()
+{
+    os_unfair_lock _renderLock;
+    NSString *_renderedString;
+}
+
+@property (nonatomic, copy) NSArray<NSString *> *keys;
+@property (nonatomic, copy) NSArray<NSString *> *values;
+@property (nonatomic, strong) SproutDiagnosticContext *parent;
+
+@end
+
+@implementation SproutDiagnosticContext
+
++ (SproutDiagnosticContext *)currentContext
+{
+    return SproutDiagnosticContextCurrent();
+}
+
++ (void)setCurrentContext:(SproutDiagnosticContext *)context
+{
+    pthread_key_t key = sproutContextKey();
+    void *previous = pthread_getspecific(key);
+    if (previous == (__bridge void *)context)
+    {
+        return;
+    }
+
+    pthread_setspecific(key, context ? CFBridgingRetain(context) : NULL);
+    sproutReleaseContext(previous);
+}
+
++ (void)pushValue:(NSString *)value forKey:(NSString *)key
+{
+    if (!key)
+    {
+        return;
+    }
+
+    SproutDiagnosticContext *current = [self currentContext];
+    SproutDiagnosticContext *context = [[SproutDiagnosticContext alloc] init];
+    context.parent = current;
+
+    NSUInteger index = [current.keys indexOfObject:key];
+    if (current && index != NSNotFound)
+    {
+        NSMutableArray<NSString *> *values = [current.values mutableCopy];
+        values[index] = [value copy] ?: @"";
+        context.keys = current.keys;
+        context.values = values;
+    }
+    else
+    {
+        context.keys = current ? [current.keys arrayByAddingObject:key] : @[key];
+        context.values = current ? [current.values arrayByAddingObject:[value copy] ?: @""] : @[[value copy] ?: @""];
+    }
+
+    [self setCurrentContext:context];
+}
+
++ (void)pop
+{
+    [self setCurrentContext:[self currentContext].parent];
+}
+
++ (void)withValue:(NSString *)value forKey:(NSString *)key perform:(void (^NS_NOESCAPE)(void))block
+{
+    SproutDiagnosticContext *previous = [self currentContext];
+    [self pushValue:value forKey:key];
+    block();
+    [self setCurrentContext:previous];
+}
+
+- (instancetype)init
+{
+    if ((self = [super init]))
+    {
+        _renderLock = OS_UNFAIR_LOCK_INIT;
+    }
+
+    return self;
+}
+
+- (NSString *)valueForContextKey:(NSString *)key
+{
+    NSUInteger index = [self.keys indexOfObject:key];
+    return index == NSNotFound ? nil : self.values[index];
+}
+
+- (SproutDiagnosticContext *)contextByProcessingValues:(NSString *(^NS_NOESCAPE)(NSString *value))block
+{
+    NSArray<NSString *> *values = self.values;
+    NSMutableArray<NSString *> *processedValues = nil;
+    for (NSUInteger i = 0; i < values.count; ++i)
+    {
+        NSString *value = block(values[i]);
+        if (value != values[i])
+        {
+            processedValues = processedValues ?: [values mutableCopy];
+            processedValues[i] = [value copy] ?: @"";
+        }
+    }
+
+    if (!processedValues)
+    {
+        return self;
+    }
+
+    SproutDiagnosticContext *retVal = [[SproutDiagnosticContext alloc] init];
+    retVal.keys = self.keys;
+    retVal.values = processedValues;
+    retVal.parent = self.parent;
+    return retVal;
+}
+
+- (NSString *)renderedString
+{
+    os_unfair_lock_lock(&_renderLock);
+    if (!_renderedString)
+    {
+        NSMutableString *rendered = [NSMutableString string];
+        [self.keys enumerateObjectsUsingBlock:^(NSString *key, NSUInteger idx, BOOL *stop) {
+            [rendered appendFormat:@"%@%@=%@", idx > 0 ? @" " : @"", key, self.values[idx]];
+        }];
+        _renderedString = [rendered copy];
+    }
+    NSString *retVal = _renderedString;
+    os_unfair_lock_unlock(&_renderLock);
+
+    return retVal;
+}
+
+- (NSString *)description
+{
+    return self.renderedString;
+}
+
+@end
@@ -0,0 +1,78 @@
+//
+//  SproutFileLogRouter.h
+//
+//  Part of "Sprout" https://github.com/levigroker/Sprout
+//
+//  Created on October 19, 2026.
+//  Copyright (c) 2026 Levi Brown <mailto:levigroker@gmail.com> This work is
+//  licensed under the Creative Commons Attribution 4.0 International License. To
+//  view a copy of this license, visit https://creativecommons.org/licenses/by/4.0/
+//  or send a letter to Creative Commons, PO Box 1866, Mountain View, CA 94042, USA.
+//
+//  The above attribution and the included license must accompany any version of
+//  the source code, binary distributable, or derivatives.
+//
+
+#import <Foundation/Foundation.h>
+#import <CocoaLumberjack/CocoaLumberjack.h>
+
+/**
+ A logger which writes each log message to one of several `DDFileLogger`s, chosen by the message's context.
+ This lets each context (i.e. networking, sync, Sprout's own `SPROUT_LOG_CONTEXT`) have its own log files, with their own
+ size, rolling and retention settings, so a noisy context can't push a quiet one's history out of the logs directory.
+
+ The router itself is added to `DDLog`; the file loggers it routes to should not be. Messages are formatted once, by the
+ router's `logFormatter`, and the formatted data is handed to the chosen file logger (on that logger's queue), so the file
+ loggers' own log formatters are not used. The exception is a file logger which writes its own format by overriding
+ `logMessage:` (i.e. `SproutCompressedFileLogger` or `SproutBinaryFileLogger`): it is given the message itself, so its
+ files stay decodable, and it formats the message with its own log formatter (if it uses one). The message has first been
+ through the stages of the router's log formatter (i.e. Sprout's `redactor`, see `SproutStagedLogFormatter`), so nothing
+ the router would have redacted reaches its files.
+ Each file logger should have its own `logFileManager` (and logs directory).
+ */
+@interface SproutFileLogRouter : DDAbstractLogger <DDLogger>
+
+/**
+ The file logger for messages whose context has no file logger of its own. If `nil` such messages are dropped.
+ */
+@property (nonatomic, strong, readonly) DDFileLogger *defaultFileLogger;
+
+/**
+ All the file loggers routed to, including the `defaultFileLogger` and any added with `addFileLogger:forFlags:`.
+ */
+@property (nonatomic, copy, readonly) NSArray<DDFileLogger *> *fileLoggers;
+
+- (instancetype)initWithDefaultFileLogger:(DDFileLogger *)defaultFileLogger;
+
+/**
+ Routes messages with the given context to the given file logger, replacing any file logger already set for the context.
+
+ @param fileLogger The file logger to route to. If `nil` messages with the given context go to the `defaultFileLogger`.
+ @param context The log context to route.
+ */
+- (void)setFileLogger:(DDFileLogger *)fileLogger forContext:(NSInteger)context;
+
+/**
+ @param context A log context.
+ @return The file logger messages with the given context are routed to.
+ */
+- (DDFileLogger *)fileLoggerForContext:(NSInteger)context;
+
+/**
+ @param fileLogger A file logger set with `setFileLogger:forContext:`.
+ @return The contexts (`NSNumber`s) routed to the given file logger.
+ */
+- (NSArray<NSNumber *> *)contextsForFileLogger:(DDFileLogger *)fileLogger;
+
+/**
+ Adds a file logger which receives every message (whatever its context) with one of the given flags, in addition to the
+ file logger the message is routed to by its context. The message is still only formatted once.
+ This allows tiered retention, i.e. a file logger for errors and warnings which keeps its files far longer than the
+ (much busier) `defaultFileLogger` does.
+
+ @param fileLogger The file logger to add.
+ @param flags A mask of the `DDLogFlag`s of the messages to write to the file logger.
+ */
+- (void)addFileLogger:(DDFileLogger *)fileLogger forFlags:(DDLogFlag)flags;
+
+@end
@@ -0,0 +1,264 @@
+//
+//  SproutFileLogRouter.m
+//
+//  Part of "Sprout" https://github.com/levigroker/Sprout
+//
+//  Created on October 19, 2026.
+//  Copyright (c) 2026 Levi Brown <mailto:levigroker@gmail.com> This work is
+//  licensed under the Creative Commons Attribution 4.0 International License. To
+//  view a copy of this license, visit https://creativecommons.org/licenses/by/4.0/
+//  or send a letter to Creative Commons, PO Box 1866, Mountain View, CA 94042, USA.
+//
+//  The above attribution and the included license must accompany any version of
+//  the source code, binary distributable, or derivatives.
+//
+
+#import "SproutFileLogRouter.h"
+#import "SproutStagedLogFormatter.h"
+
+static NSString * const kSproutFileLogRouterLoggerName = @"com.levigroker.sprout.filelogrouter";
+
+//`DDFileLogger` internals (see DDFileLogger+Internal.h, which CocoaLumberjack does not make public)
+@interface DDFileLogger (SproutFileLogRouter)
+
+//Writes the given (already formatted) data to the current log file. When called on the logger's queue this happens synchronously.
+- (void)logData:(NSData *)data;
+
+@end
+
+//A file logger receiving messages by flag (see `addFileLogger:forFlags:`)
+/**
+ @return `YES` if the file logger writes messages in its own format (i.e. `SproutCompressedFileLogger` and
+ `SproutBinaryFileLogger`), by overriding `logMessage:`, so must be given the messages rather than formatted text.
+ */
+static BOOL sproutFileLoggerWritesOwnFormat(DDFileLogger *fileLogger)
+{
+    static IMP fileLoggerLogMessage = NULL;
+    static dispatch_once_t onceToken;
+    dispatch_once(&onceToken, ^{
+        fileLoggerLogMessage = [DDFileLogger instanceMethodForSelector:@selector(logMessage:)];
+    });
+
+    return [fileLogger methodForSelector:@selector(logMessage:)] != fileLoggerLogMessage;
+}
+
+@interface SproutFileLogTier : NSObject
+
+@property (nonatomic, strong, readonly) DDFileLogger *fileLogger;
+@property (nonatomic, assign, readonly) DDLogFlag flags;
+
+@end
+
+@implementation SproutFileLogTier
+
+- (instancetype)initWithFileLogger:(DDFileLogger *)fileLogger flags:(DDLogFlag)flags
+{
+    if ((self = [super init]))
+    {
+        _fileLogger = fileLogger;
+        _flags = flags;
+    }
+
+    return self;
+}
+
+@end
+
+@interface SproutFileLogRouter ()
+
+//Context (NSNumber) to file logger. Replaced, never mutated, so it can be read from the logger queue without locking.
+@property (atomic, copy) NSDictionary<NSNumber *, DDFileLogger *> *routes;
+//As above, replaced, never mutated.
+@property (atomic, copy) NSArray<SproutFileLogTier *> *tiers;
+
+@end
+
+@implementation SproutFileLogRouter
+
+- (instancetype)initWithDefaultFileLogger:(DDFileLogger *)defaultFileLogger
+{
+    if ((self = [super init]))
+    {
+        _defaultFileLogger = defaultFileLogger;
+        _routes = @{};
+        _tiers = @[];
+    }
+
+    return self;
+}
+
+#pragma mark - Routes
+
+- (void)setFileLogger:(DDFileLogger *)fileLogger forContext:(NSInteger)context
+{
+    @synchronized (self)
+    {
+        NSMutableDictionary<NSNumber *, DDFileLogger *> *routes = [self.routes mutableCopy];
+        routes[@(context)] = fileLogger;
+        self.routes = routes;
+    }
+}
+
+- (DDFileLogger *)fileLoggerForContext:(NSInteger)context
+{
+    return self.routes[@(context)] ?: self.defaultFileLogger;
+}
+
+- (NSArray<NSNumber *> *)contextsForFileLogger:(DDFileLogger *)fileLogger
+{
+    return [self.routes allKeysForObject:fileLogger];
+}
+
+- (void)addFileLogger:(DDFileLogger *)fileLogger forFlags:(DDLogFlag)flags
+{
+    if (!fileLogger)
+    {
+        return;
+    }
+
+    @synchronized (self)
+    {
+        self.tiers = [self.tiers arrayByAddingObject:[[SproutFileLogTier alloc] initWithFileLogger:fileLogger flags:flags]];
+    }
+}
+
+- (NSArray<DDFileLogger *> *)fileLoggers
+{
+    NSMutableOrderedSet<DDFileLogger *> *retVal = [NSMutableOrderedSet orderedSet];
+    if (self.defaultFileLogger)
+    {
+        [retVal addObject:self.defaultFileLogger];
+    }
+    [retVal addObjectsFromArray:self.routes.allValues];
+    for (SproutFileLogTier *tier in self.tiers)
+    {
+        [retVal addObject:tier.fileLogger];
+    }
+
+    return retVal.array;
+}
+
+#pragma mark - DDLogger
+
+- (void)logMessage:(DDLogMessage *)logMessage
+{
+    //The file loggers which write their own format are not given formatted text, so the router's level is checked here
+    if (!SproutLogFormatterAcceptsLogMessage(_logFormatter, logMessage))
+    {
+        return;
+    }
+
+    //Formatted lazily, and at most once, for all the file loggers receiving the message
+    NSData *data = nil;
+    //As above, for the file loggers which write their own format
+    DDLogMessage *processedMessage = nil;
+
+    DDFileLogger *fileLogger = [self fileLoggerForContext:logMessage->_context];
+    if (fileLogger && sproutFileLoggerWritesOwnFormat(fileLogger))
+    {
+        processedMessage = SproutLogMessageProcessedForLogFormatter(logMessage, _logFormatter);
+        [self logMessage:processedMessage toFileLogger:fileLogger];
+    }
+    else if (fileLogger)
+    {
+        data = [self dataForLogMessage:logMessage];
+        if (data.length == 0)
+        {
+            return;
+        }
+
+        [self logData:data toFileLogger:fileLogger];
+    }
+
+    for (SproutFileLogTier *tier in self.tiers)
+    {
+        if (!(tier.flags & logMessage->_flag) || tier.fileLogger == fileLogger)
+        {
+            continue;
+        }
+
+        if (sproutFileLoggerWritesOwnFormat(tier.fileLogger))
+        {
+            processedMessage = processedMessage ?: SproutLogMessageProcessedForLogFormatter(logMessage, _logFormatter);
+            [self logMessage:processedMessage toFileLogger:tier.fileLogger];
+        }
+        else
+        {
+            data = data ?: [self dataForLogMessage:logMessage];
+            if (data.length == 0)
+            {
+                return;
+            }
+
+            [self logData:data toFileLogger:tier.fileLogger];
+        }
+    }
+}
+
+- (void)flush
+{
+    for (DDFileLogger *fileLogger in self.fileLoggers)
+    {
+        dispatch_sync(fileLogger.loggerQueue, ^{ @autoreleasepool {
+            [fileLogger flush];
+        } });
+    }
+}
+
+- (void)willRemoveLogger
+{
+    for (DDFileLogger *fileLogger in self.fileLoggers)
+    {
+        dispatch_sync(fileLogger.loggerQueue, ^{ @autoreleasepool {
+            [fileLogger willRemoveLogger];
+        } });
+    }
+}
+
+- (DDLoggerName)loggerName
+{
+    return kSproutFileLogRouterLoggerName;
+}
+
+#pragma mark - Helpers
+
+- (NSData *)dataForLogMessage:(DDLogMessage *)logMessage
+{
+    NSString *message = logMessage->_message;
+    if (_logFormatter)
+    {
+        message = [_logFormatter formatLogMessage:logMessage];
+    }
+
+    if (message.length == 0)
+    {
+        return nil;
+    }
+
+    if (![message hasSuffix:@"\n"])
+    {
+        message = [message stringByAppendingString:@"\n"];
+    }
+
+    return [message dataUsingEncoding:NSUTF8StringEncoding];
+}
+
+- (void)logData:(NSData *)data toFileLogger:(DDFileLogger *)fileLogger
+{
+    //Synchronous, so messages reach each file in order, and a busy file applies back pressure just as it would if it were added to `DDLog` itself.
+    dispatch_sync(fileLogger.loggerQueue, ^{ @autoreleasepool {
+        [fileLogger logData:data];
+    } });
+}
+
+//For file loggers which write their own format (see `sproutFileLoggerWritesOwnFormat`). The message should already have been
+//through the stages of the router's formatter, as the file logger's own formatter (if any) is not Sprout's.
+- (void)logMessage:(DDLogMessage *)logMessage toFileLogger:(DDFileLogger *)fileLogger
+{
+    //Synchronous, as above
+    dispatch_sync(fileLogger.loggerQueue, ^{ @autoreleasepool {
+        [fileLogger logMessage:logMessage];
+    } });
+}
+
+@end
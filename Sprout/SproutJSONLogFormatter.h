@@ -0,0 +1,42 @@
+//
+//  SproutJSONLogFormatter.h
+//
+//  Part of "Sprout" https://github.com/levigroker/Sprout
+//
+//  Created on October 19, 2026.
+//  Copyright (c) 2026 Levi Brown <mailto:levigroker@gmail.com> This work is
+//  licensed under the Creative Commons Attribution 4.0 International License. To
+//  view a copy of this license, visit https://creativecommons.org/licenses/by/4.0/
+//  or send a letter to Creative Commons, PO Box 1866, Mountain View, CA 94042, USA.
+//
+//  The above attribution and the included license must accompany any version of
+//  the source code, binary distributable, or derivatives.
+//
+
+#import <Foundation/Foundation.h>
+#import <CocoaLumberjack/CocoaLumberjack.h>
+#import "SproutSharedLogFormatter.h"
+
+/**
+ A log formatter which formats each log message as a single line JSON object (JSON Lines), for log pipelines which
+ would otherwise have to parse the text output of `SproutCustomLogFormatter`.
+
+ Example (wrapped here for readability):
+
+     {"ts":1792425600123456,"level":"info","context":0,"thread":"60b","queue":"com.apple.main-thread",
+      "file":"Sprout.m","function":"-[Sprout startLogging]","line":164,"message":"CocoaLumberjack loggers initialized!"}
+
+ * `ts` is the message timestamp, in microseconds since 1970.
+ * `level` is one of `error`, `warning`, `info`, `debug` or `verbose`.
+ * `fields` is included if the message was logged with key/value fields (see `SproutLogFields.h`), as an object of
+   their native (number, boolean or string) values.
+ * `mdc` is included if the message captured a `SproutDiagnosticContext`, as an object of its key/value pairs.
+ * `tag` is included if the message has any other `representedObject`. Numbers and booleans are written as JSON numbers and
+   booleans, and anything else as a string (its `description`).
+
+ The JSON is written directly into a byte buffer (strings which need no escaping are copied as is), rather than being
+ built with `NSJSONSerialization`.
+ */
+@interface SproutJSONLogFormatter : NSObject <SproutLogFormatterEquivalence>
+
+@end
@@ -0,0 +1,262 @@
+//
+//  SproutJSONLogFormatter.m
+//
+//  Part of "Sprout" https://github.com/levigroker/Sprout
+//
+//  Created on October 19, 2026.
+//  Copyright (c) 2026 Levi Brown <mailto:levigroker@gmail.com> This work is
+//  licensed under the Creative Commons Attribution 4.0 International License. To
+//  view a copy of this license, visit https://creativecommons.org/licenses/by/4.0/
+//  or send a letter to Creative Commons, PO Box 1866, Mountain View, CA 94042, USA.
+//
+//  The above attribution and the included license must accompany any version of
+//  the source code, binary distributable, or derivatives.
+//
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#import "SproutJSONLogFormatter.h"
+#import "SproutLogBuffer.h"
+#import "SproutLogFields.h"
+
+//Non-zero for the bytes which must be escaped within a JSON string: control characters, quote and backslash.
+//The value is the character following the backslash, or 'u' for a `\u00XX` escape.
+static uint8_t const kSproutJSONEscapes[256] =
+{
+    'u', 'u', 'u', 'u', 'u', 'u', 'u', 'u', 'b', 't', 'n', 'u', 'f', 'r', 'u', 'u',
+    'u', 'u', 'u', 'u', 'u', 'u', 'u', 'u', 'u', 'u', 'u', 'u', 'u', 'u', 'u', 'u',
+    0, 0, '"', 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, '\\', 0, 0, 0,
+    //The remaining bytes (including all UTF-8 multi-byte sequences) are written as is
+};
+
+static void sproutJSONAppendEscaped(SproutLogBuffer *buffer, const uint8_t *bytes, size_t length)
+{
+    static char const hexDigits[] = "0123456789abcdef";
+
+    size_t runStart = 0;
+    for (size_t i = 0; i < length; ++i)
+    {
+        uint8_t escape = kSproutJSONEscapes[bytes[i]];
+        if (escape == 0)
+        {
+            continue;
+        }
+
+        //Copy the run of bytes which needed no escaping in one go
+        SproutLogBufferAppendBytes(buffer, bytes + runStart, i - runStart);
+        runStart = i + 1;
+
+        if (escape == 'u')
+        {
+            char unicodeEscape[6] = { '\\', 'u', '0', '0', hexDigits[bytes[i] >> 4], hexDigits[bytes[i] & 0xF] };
+            SproutLogBufferAppendBytes(buffer, unicodeEscape, sizeof(unicodeEscape));
+        }
+        else
+        {
+            char simpleEscape[2] = { '\\', (char)escape };
+            SproutLogBufferAppendBytes(buffer, simpleEscape, sizeof(simpleEscape));
+        }
+    }
+
+    SproutLogBufferAppendBytes(buffer, bytes + runStart, length - runStart);
+}
+
+static inline void sproutJSONAppendString(SproutLogBuffer *buffer, NSString *string)
+{
+    SproutLogBufferAppendByte(buffer, '"');
+    SproutLogBufferWithUTF8(string, ^(const uint8_t *bytes, size_t length) {
+        sproutJSONAppendEscaped(buffer, bytes, length);
+    });
+    SproutLogBufferAppendByte(buffer, '"');
+}
+
+static inline void sproutJSONAppendDouble(SproutLogBuffer *buffer, double value)
+{
+    //JSON has no representation for NaN or infinity
+    if (!isfinite(value))
+    {
+        SproutLogBufferAppendCString(buffer, "null");
+        return;
+    }
+
+    //The shorter form, unless it doesn't read back as the same value
+    char digits[32];
+    int length = snprintf(digits, sizeof(digits), "%.15g", value);
+    if (strtod(digits, NULL) != value)
+    {
+        length = snprintf(digits, sizeof(digits), "%.17g", value);
+    }
+    SproutLogBufferAppendBytes(buffer, digits, (size_t)length);
+}
+
+//`key` must be a literal which needs no escaping (i.e. `"message":`)
+#define SPROUT_JSON_APPEND_KEY(buffer, key) SproutLogBufferAppendBytes((buffer), (key), sizeof(key) - 1)
+
+@implementation SproutJSONLogFormatter
+
+- (NSString *)formatLogMessage:(DDLogMessage *)logMessage
+{
+    const char *level = NULL;
+    switch (logMessage->_flag)
+    {
+        case DDLogFlagError   : level = "\"error\""; break;
+        case DDLogFlagWarning : level = "\"warning\""; break;
+        case DDLogFlagInfo    : level = "\"info\""; break;
+        case DDLogFlagDebug   : level = "\"debug\""; break;
+        case DDLogFlagVerbose :
+        default               : level = "\"verbose\""; break;
+    }
+
+    NSString *file = logMessage->_fileName.length > 0 ? logMessage->_fileName : [logMessage->_file lastPathComponent];
+    int64_t timestamp = (int64_t)llround(logMessage->_timestamp.timeIntervalSince1970 * 1000000.0);
+
+    SproutLogBuffer buffer;
+    SproutLogBufferInit(&buffer);
+
+    SPROUT_JSON_APPEND_KEY(&buffer, "{\"ts\":");
+    SproutLogBufferAppendInteger(&buffer, timestamp);
+    SPROUT_JSON_APPEND_KEY(&buffer, ",\"level\":");
+    SproutLogBufferAppendCString(&buffer, level);
+    SPROUT_JSON_APPEND_KEY(&buffer, ",\"context\":");
+    SproutLogBufferAppendInteger(&buffer, logMessage->_context);
+    SPROUT_JSON_APPEND_KEY(&buffer, ",\"thread\":");
+    sproutJSONAppendString(&buffer, logMessage->_threadID);
+    SPROUT_JSON_APPEND_KEY(&buffer, ",\"queue\":");
+    sproutJSONAppendString(&buffer, logMessage->_queueLabel);
+    SPROUT_JSON_APPEND_KEY(&buffer, ",\"file\":");
+    sproutJSONAppendString(&buffer, file);
+    SPROUT_JSON_APPEND_KEY(&buffer, ",\"function\":");
+    sproutJSONAppendString(&buffer, logMessage->_function);
+    SPROUT_JSON_APPEND_KEY(&buffer, ",\"line\":");
+    SproutLogBufferAppendInteger(&buffer, (int64_t)logMessage->_line);
+    SPROUT_JSON_APPEND_KEY(&buffer, ",\"message\":");
+    sproutJSONAppendString(&buffer, logMessage->_message);
+
+    id tag = logMessage->_representedObject;
+    SproutLogFields *fields = SproutLogMessageFields(logMessage);
+    SproutDiagnosticContext *diagnosticContext = SproutLogMessageDiagnosticContext(logMessage);
+    if (fields)
+    {
+        SPROUT_JSON_APPEND_KEY(&buffer, ",\"fields\":");
+        [self appendFields:fields toBuffer:&buffer];
+    }
+    if (diagnosticContext)
+    {
+        SPROUT_JSON_APPEND_KEY(&buffer, ",\"mdc\":");
+        [self appendDiagnosticContext:diagnosticContext toBuffer:&buffer];
+    }
+    if (tag && !fields && !diagnosticContext)
+    {
+        SPROUT_JSON_APPEND_KEY(&buffer, ",\"tag\":");
+        [self appendTag:tag toBuffer:&buffer];
+    }
+
+    SproutLogBufferAppendByte(&buffer, '}');
+
+    return SproutLogBufferCopyString(&buffer);
+}
+
+#pragma mark SproutLogFormatterEquivalence
+
+- (BOOL)isEquivalentToLogFormatter:(id<DDLogFormatter>)formatter
+{
+    //There is nothing to configure
+    return [formatter isMemberOfClass:[self class]];
+}
+
+#pragma mark Helpers
+
+- (void)appendFields:(SproutLogFields *)fields toBuffer:(SproutLogBuffer *)buffer
+{
+    SproutLogBufferAppendByte(buffer, '{');
+    for (NSUInteger i = 0; i < fields.count; ++i)
+    {
+        if (i > 0)
+        {
+            SproutLogBufferAppendByte(buffer, ',');
+        }
+        sproutJSONAppendString(buffer, [fields keyAtIndex:i]);
+        SproutLogBufferAppendByte(buffer, ':');
+
+        switch ([fields typeAtIndex:i])
+        {
+            case SproutLogFieldTypeInteger:
+                SproutLogBufferAppendInteger(buffer, [fields integerValueAtIndex:i]);
+                break;
+            case SproutLogFieldTypeUnsigned:
+                SproutLogBufferAppendPaddedInteger(buffer, [fields unsignedValueAtIndex:i], 1);
+                break;
+            case SproutLogFieldTypeDouble:
+                sproutJSONAppendDouble(buffer, [fields doubleValueAtIndex:i]);
+                break;
+            case SproutLogFieldTypeBool:
+                SproutLogBufferAppendCString(buffer, [fields boolValueAtIndex:i] ? "true" : "false");
+                break;
+            case SproutLogFieldTypeObject:
+            {
+                id object = [fields objectValueAtIndex:i];
+                if (object)
+                {
+                    [self appendTag:object toBuffer:buffer];
+                }
+                else
+                {
+                    SproutLogBufferAppendCString(buffer, "null");
+                }
+                break;
+            }
+        }
+    }
+    SproutLogBufferAppendByte(buffer, '}');
+}
+
+- (void)appendDiagnosticContext:(SproutDiagnosticContext *)context toBuffer:(SproutLogBuffer *)buffer
+{
+    SproutLogBufferAppendByte(buffer, '{');
+    [context.keys enumerateObjectsUsingBlock:^(NSString *key, NSUInteger idx, BOOL *stop) {
+        if (idx > 0)
+        {
+            SproutLogBufferAppendByte(buffer, ',');
+        }
+        sproutJSONAppendString(buffer, key);
+        SproutLogBufferAppendByte(buffer, ':');
+        sproutJSONAppendString(buffer, [context valueForContextKey:key]);
+    }];
+    SproutLogBufferAppendByte(buffer, '}');
+}
+
+- (void)appendTag:(id)tag toBuffer:(SproutLogBuffer *)buffer
+{
+    if (tag == (id)kCFBooleanTrue || tag == (id)kCFBooleanFalse)
+    {
+        SproutLogBufferAppendCString(buffer, tag == (id)kCFBooleanTrue ? "true" : "false");
+    }
+    else if ([tag isKindOfClass:NSNumber.class])
+    {
+        NSNumber *number = tag;
+        //JSON has no representation for NaN or infinity
+        if (CFNumberIsFloatType((__bridge CFNumberRef)number) && !isfinite(number.doubleValue))
+        {
+            SproutLogBufferAppendCString(buffer, "null");
+        }
+        else
+        {
+            SproutLogBufferAppendString(buffer, number.stringValue);
+        }
+    }
+    else if ([tag isKindOfClass:NSString.class])
+    {
+        sproutJSONAppendString(buffer, tag);
+    }
+    else
+    {
+        sproutJSONAppendString(buffer, [tag description]);
+    }
+}
+
+@end
@@ -0,0 +1,93 @@
+//
+//  SproutLog.swift
+//
+//  Part of "Sprout" https://github.com/levigroker/Sprout
+//
+//  Created on October 19, 2026.
+//  Copyright (c) 2026 Levi Brown <mailto:levigroker@gmail.com> This work is
+//  licensed under the Creative Commons Attribution 4.0 International License. To
+//  view a copy of this license, visit https://creativecommons.org/licenses/by/4.0/
+//  or send a letter to Creative Commons, PO Box 1866, Mountain View, CA 94042, USA.
+//
+//  The above attribution and the included license must accompany any version of
+//  the source code, binary distributable, or derivatives.
+//
+
+import Foundation
+import CocoaLumberjack
+
+/**
+ Sprout's Swift logging front end.
+
+ The message is an `@autoclosure`, and the level check is `@inlinable` (a relaxed atomic load and a test, see
+ SproutLogLevels.h), so a disabled statement neither builds its message nor allocates. An enabled statement passes
+ its `StaticString` file and function to the log call as C strings, rather than bridging them to `NSString`.
+
+     SproutLog.debug("Loaded \(items.count) items")
+     SproutLog.info("Request finished", context: kNetworkingLogContext)
+
+ The statement's module (for `-[Sprout setLogLevel:forModule:]`) is its file name, without extension.
+ */
+public enum SproutLog {
+
+    @inlinable
+    public static func error(_ message: @autoclosure () -> String, context: Int = 0, tag: Any? = nil, file: StaticString = #fileID, function: StaticString = #function, line: UInt = #line) {
+        //Errors are logged synchronously, as CocoaLumberjack's `DDLogError` does
+        log(.error, asynchronous: false, message(), context: context, tag: tag, file: file, function: function, line: line)
+    }
+
+    @inlinable
+    public static func warn(_ message: @autoclosure () -> String, context: Int = 0, tag: Any? = nil, file: StaticString = #fileID, function: StaticString = #function, line: UInt = #line) {
+        log(.warning, asynchronous: true, message(), context: context, tag: tag, file: file, function: function, line: line)
+    }
+
+    @inlinable
+    public static func info(_ message: @autoclosure () -> String, context: Int = 0, tag: Any? = nil, file: StaticString = #fileID, function: StaticString = #function, line: UInt = #line) {
+        log(.info, asynchronous: true, message(), context: context, tag: tag, file: file, function: function, line: line)
+    }
+
+    @inlinable
+    public static func debug(_ message: @autoclosure () -> String, context: Int = 0, tag: Any? = nil, file: StaticString = #fileID, function: StaticString = #function, line: UInt = #line) {
+        log(.debug, asynchronous: true, message(), context: context, tag: tag, file: file, function: function, line: line)
+    }
+
+    @inlinable
+    public static func verbose(_ message: @autoclosure () -> String, context: Int = 0, tag: Any? = nil, file: StaticString = #fileID, function: StaticString = #function, line: UInt = #line) {
+        log(.verbose, asynchronous: true, message(), context: context, tag: tag, file: file, function: function, line: line)
+    }
+
+    /**
+     Logs the message, if the log levels allow the flag for the context and the file's module.
+     */
+    @inlinable
+    public static func log(_ flag: DDLogFlag, asynchronous: Bool, _ message: @autoclosure () -> String, context: Int = 0, tag: Any? = nil, file: StaticString = #fileID, function: StaticString = #function, line: UInt = #line) {
+        guard isEnabled(flag, context: context, file: file) else {
+            return
+        }
+        send(flag, asynchronous: asynchronous, message(), context: context, tag: tag, file: file, function: function, line: line)
+    }
+
+    /**
+     - Returns: `true` if the log levels allow the flag for the context and the file's module.
+     */
+    @inlinable
+    public static func isEnabled(_ flag: DDLogFlag, context: Int = 0, file: StaticString = #fileID) -> Bool {
+        return SproutLogLevelIsEnabled(SproutLogLevelCurrent(), UInt32(truncatingIfNeeded: flag.rawValue), context, cString(file))
+    }
+
+    //Not inlined, so the statement only adds the check and a call to the caller
+    @usableFromInline
+    static func send(_ flag: DDLogFlag, asynchronous: Bool, _ message: String, context: Int, tag: Any?, file: StaticString, function: StaticString, line: UInt) {
+        let level = DDLogLevel(rawValue: UInt(SproutLogLevelCurrent() & SPROUT_LOG_LEVEL_MASK)) ?? .all
+        SproutLogMessageCold(asynchronous, level, flag, context, cString(file), cString(function), line, tag, message)
+    }
+
+    //Static strings with a pointer representation are stored null terminated
+    @inlinable
+    static func cString(_ string: StaticString) -> UnsafePointer<CChar>? {
+        guard string.hasPointerRepresentation else {
+            return nil
+        }
+        return UnsafeRawPointer(string.utf8Start).assumingMemoryBound(to: CChar.self)
+    }
+}
@@ -0,0 +1,89 @@
+//
+//  SproutLogArguments.h
+//
+//  Part of "Sprout" https://github.com/levigroker/Sprout
+//
+//  Created on October 19, 2026.
+//  Copyright (c) 2026 Levi Brown <mailto:levigroker@gmail.com> This work is
+//  licensed under the Creative Commons Attribution 4.0 International License. To
+//  view a copy of this license, visit https://creativecommons.org/licenses/by/4.0/
+//  or send a letter to Creative Commons, PO Box 1866, Mountain View, CA 94042, USA.
+//
+//  The above attribution and the included license must accompany any version of
+//  the source code, binary distributable, or derivatives.
+//
+
+/**
+ The compact encoding of a log statement's arguments, written by the C++ front end (see Sprout.hpp) at the call site and
+ rendered into the message text later, by the loggers. This header is plain C.
+
+ The arguments are a sequence of values, each a type uint8 followed by:
+
+     INTEGER   zigzag varint
+     UNSIGNED  varint
+     DOUBLE    8 bytes (native byte order, as the bytes never leave the process)
+     BOOL      uint8
+     CHAR      uint8
+     STRING    varint byte count, then that many UTF-8 bytes (truncated if the arguments would not fit)
+     POINTER   varint
+
+ Varints and zigzag encoding are those of the binary log format (see SproutBinaryLogFormat.h).
+ Strings should be UTF-8, but needn't be: a message rendered with bytes which are not valid UTF-8 is read as Latin-1, as
+ `sprout_log` messages are, rather than lost.
+ */
+
+#ifndef _SPROUT_LOG_ARGUMENTS_H
+#define _SPROUT_LOG_ARGUMENTS_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "SproutBinaryLogFormat.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+//The most bytes of arguments a statement encodes. Strings are truncated to fit.
+#define SPROUT_LOG_ARGUMENTS_CAPACITY 512
+
+typedef enum
+{
+    SproutLogArgumentTypeInteger = 1,
+    SproutLogArgumentTypeUnsigned = 2,
+    SproutLogArgumentTypeDouble = 3,
+    SproutLogArgumentTypeBool = 4,
+    SproutLogArgumentTypeChar = 5,
+    SproutLogArgumentTypeString = 6,
+    SproutLogArgumentTypePointer = 7,
+} SproutLogArgumentType;
+
+/**
+ Logs a message which will be rendered from `format` and the encoded arguments when a logger first reads it (on the
+ logger's queue, rather than the calling thread). Each `{}` in the format is replaced by the next argument, and `{{` and
+ `}}` stand for `{` and `}`.
+ The arguments are copied into the message itself, so the message and its arguments are one allocation (besides the
+ `DDLogMessage`).
+ @param format A format with static storage (i.e. a string literal), as it is only read once the message is logged.
+ @param file The file name, with static storage (i.e. `__FILE__`), as its string is made once and kept.
+ @param function The function name, with static storage (i.e. `__PRETTY_FUNCTION__`), as its string is made once and kept.
+ */
+void SproutLogArgumentsLog(uint32_t flag, intptr_t context, const char *file, const char *function, unsigned int line,
+                           const char *format, const uint8_t *arguments, size_t length)
+    __attribute__((cold, noinline));
+
+/**
+ Logs the given text (i.e. formatted by `sprout_log`, see SproutCLog.h), which is copied into the message and only made
+ into a string when a logger first reads it. Text which is not valid UTF-8 is read as Latin-1.
+ @param file The file name, with static storage (i.e. `__FILE__`), as its string is made once and kept.
+ @param function The function name, with static storage (i.e. `__func__`), as its string is made once and kept.
+ */
+void SproutLogTextLog(uint32_t flag, intptr_t context, const char *file, const char *function, unsigned int line,
+                      const char *text, size_t length)
+    __attribute__((cold, noinline));
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _SPROUT_LOG_ARGUMENTS_H */
@@ -0,0 +1,324 @@
+//
+//  SproutLogArguments.m
+//
+//  Part of "Sprout" https://github.com/levigroker/Sprout
+//
+//  Created on October 19, 2026.
+//  Copyright (c) 2026 Levi Brown <mailto:levigroker@gmail.com> This work is
+//  licensed under the Creative Commons Attribution 4.0 International License. To
+//  view a copy of this license, visit https://creativecommons.org/licenses/by/4.0/
+//  or send a letter to Creative Commons, PO Box 1866, Mountain View, CA 94042, USA.
+//
+//  The above attribution and the included license must accompany any version of
+//  the source code, binary distributable, or derivatives.
+//
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#import <os/lock.h>
+#import <objc/runtime.h>
+
+#import "SproutLogArguments.h"
+#import "SproutLogBuffer.h"
+#import "SproutLogMacros.h"
+
+#pragma mark - Rendering
+
+//Text which may not be UTF-8 (i.e. from a `%s` argument, or a `std::string` of raw bytes) is kept as Latin-1, rather than
+//the message being lost
+static NSString *sproutMessageString(const uint8_t *bytes, size_t length)
+{
+    return [[NSString alloc] initWithBytes:bytes length:length encoding:NSUTF8StringEncoding]
+        ?: [[NSString alloc] initWithBytes:bytes length:length encoding:NSISOLatin1StringEncoding];
+}
+
+static void sproutAppendDouble(SproutLogBuffer *buffer, double value)
+{
+    //The shortest of the usual precisions which reads back as the same value
+    char text[32];
+    int length = snprintf(text, sizeof(text), "%.15g", value);
+    if (strtod(text, NULL) != value)
+    {
+        length = snprintf(text, sizeof(text), "%.17g", value);
+    }
+    SproutLogBufferAppendBytes(buffer, text, (size_t)length);
+}
+
+/**
+ Appends the argument at `*offset` and advances past it.
+ @return `NO` if there are no more arguments (or they are malformed).
+ */
+static BOOL sproutAppendArgument(SproutLogBuffer *buffer, const uint8_t *arguments, size_t length, size_t *offset)
+{
+    size_t position = *offset;
+    if (position >= length)
+    {
+        return NO;
+    }
+
+    SproutLogArgumentType type = (SproutLogArgumentType)arguments[position++];
+    uint64_t value = 0;
+
+    switch (type)
+    {
+        case SproutLogArgumentTypeInteger:
+        case SproutLogArgumentTypeUnsigned:
+        case SproutLogArgumentTypePointer:
+        case SproutLogArgumentTypeString:
+        {
+            size_t count = sproutVarintDecode(arguments + position, length - position, &value);
+            if (count == 0)
+            {
+                return NO;
+            }
+            position += count;
+            break;
+        }
+        case SproutLogArgumentTypeDouble:
+            if (length - position < sizeof(double))
+            {
+                return NO;
+            }
+            break;
+        case SproutLogArgumentTypeBool:
+        case SproutLogArgumentTypeChar:
+            if (length - position < 1)
+            {
+                return NO;
+            }
+            break;
+        default:
+            return NO;
+    }
+
+    switch (type)
+    {
+        case SproutLogArgumentTypeInteger:
+            SproutLogBufferAppendInteger(buffer, sproutZigzagDecode(value));
+            break;
+        case SproutLogArgumentTypeUnsigned:
+            SproutLogBufferAppendPaddedInteger(buffer, value, 1);
+            break;
+        case SproutLogArgumentTypePointer:
+        {
+            char text[24];
+            int textLength = snprintf(text, sizeof(text), "0x%llx", (unsigned long long)value);
+            SproutLogBufferAppendBytes(buffer, text, (size_t)textLength);
+            break;
+        }
+        case SproutLogArgumentTypeString:
+            if (value > length - position)
+            {
+                return NO;
+            }
+            SproutLogBufferAppendBytes(buffer, arguments + position, (size_t)value);
+            position += (size_t)value;
+            break;
+        case SproutLogArgumentTypeDouble:
+        {
+            double number;
+            memcpy(&number, arguments + position, sizeof(number));
+            sproutAppendDouble(buffer, number);
+            position += sizeof(number);
+            break;
+        }
+        case SproutLogArgumentTypeBool:
+            SproutLogBufferAppendCString(buffer, arguments[position++] ? "true" : "false");
+            break;
+        case SproutLogArgumentTypeChar:
+            SproutLogBufferAppendByte(buffer, arguments[position++]);
+            break;
+    }
+
+    *offset = position;
+    return YES;
+}
+
+static NSString *sproutRenderArguments(const char *format, const uint8_t *arguments, size_t length)
+{
+    SproutLogBuffer buffer;
+    SproutLogBufferInit(&buffer);
+
+    size_t offset = 0;
+    const char *literal = format;
+    const char *p = format;
+    while (*p)
+    {
+        if ((p[0] == '{' || p[0] == '}') && p[1] == p[0])
+        {
+            //An escaped brace
+            SproutLogBufferAppendBytes(&buffer, literal, (size_t)(p - literal) + 1);
+            p += 2;
+            literal = p;
+        }
+        else if (p[0] == '{' && p[1] == '}')
+        {
+            SproutLogBufferAppendBytes(&buffer, literal, (size_t)(p - literal));
+            if (!sproutAppendArgument(&buffer, arguments, length, &offset))
+            {
+                SproutLogBufferAppendBytes(&buffer, "{}", 2);
+            }
+            p += 2;
+            literal = p;
+        }
+        else
+        {
+            ++p;
+        }
+    }
+    SproutLogBufferAppendBytes(&buffer, literal, (size_t)(p - literal));
+
+    NSString *retVal = sproutMessageString(buffer.bytes, buffer.length);
+    SproutLogBufferFree(&buffer);
+    return retVal ?: @"";
+}
+
+#pragma mark - SproutDeferredLogMessageString
+
+//A message which is rendered the first time it is read, from a format and encoded arguments, or from the bytes of its text.
+//The bytes are stored after the ivars, in the same allocation.
+@interface SproutDeferredLogMessageString : NSString
+{
+    //`NULL` if the bytes are the text
+    const char *_format;
+    size_t _length;
+    os_unfair_lock _lock;
+    NSString *_rendered;
+}
+
+//The encoded arguments, or the text (the extra bytes of the instance, as `object_getIndexedIvars`)
+@property (nonatomic, readonly) uint8_t *bytes;
+
++ (instancetype)messageWithFormat:(const char *)format bytes:(const void *)bytes length:(size_t)length;
+
+@end
+
+@implementation SproutDeferredLogMessageString
+
++ (instancetype)messageWithFormat:(const char *)format bytes:(const void *)bytes length:(size_t)length
+{
+    SproutDeferredLogMessageString *retVal = class_createInstance(self, length);
+    if ((retVal = [retVal init]))
+    {
+        retVal->_format = format;
+        retVal->_length = length;
+        retVal->_lock = OS_UNFAIR_LOCK_INIT;
+        if (length > 0)
+        {
+            memcpy(retVal.bytes, bytes, length);
+        }
+    }
+
+    return retVal;
+}
+
+- (uint8_t *)bytes
+{
+    return (uint8_t *)(__bridge void *)self + class_getInstanceSize([SproutDeferredLogMessageString class]);
+}
+
+- (NSString *)rendered
+{
+    //Loggers on different queues may read the message at the same time
+    os_unfair_lock_lock(&_lock);
+    if (!_rendered)
+    {
+        _rendered = _format ? sproutRenderArguments(_format, self.bytes, _length) : sproutMessageString(self.bytes, _length);
+    }
+    NSString *retVal = _rendered;
+    os_unfair_lock_unlock(&_lock);
+
+    return retVal;
+}
+
+#pragma mark NSString
+
+- (NSUInteger)length
+{
+    return self.rendered.length;
+}
+
+- (unichar)characterAtIndex:(NSUInteger)index
+{
+    return [self.rendered characterAtIndex:index];
+}
+
+- (void)getCharacters:(unichar *)buffer range:(NSRange)range
+{
+    [self.rendered getCharacters:buffer range:range];
+}
+
+- (const char *)UTF8String
+{
+    return self.rendered.UTF8String;
+}
+
+- (id)copyWithZone:(NSZone *)zone
+{
+    //Immutable
+    return self;
+}
+
+@end
+
+#pragma mark - Logging
+
+//The `NSString` of a file or function name. Names have static storage (`__FILE__` and `__PRETTY_FUNCTION__`), so each is
+//made once, and kept for the life of the process.
+static NSString *sproutInternedName(const char *name)
+{
+    static os_unfair_lock lock = OS_UNFAIR_LOCK_INIT;
+    static NSMapTable<id, NSString *> *names = nil;
+
+    os_unfair_lock_lock(&lock);
+    if (!names)
+    {
+        names = [[NSMapTable alloc] initWithKeyOptions:NSPointerFunctionsOpaqueMemory | NSPointerFunctionsOpaquePersonality valueOptions:NSPointerFunctionsStrongMemory capacity:64];
+    }
+    NSString *retVal = (__bridge NSString *)NSMapGet(names, name);
+    os_unfair_lock_unlock(&lock);
+
+    if (!retVal)
+    {
+        //Made outside the lock, so a race only makes a spare copy
+        retVal = @(name);
+        os_unfair_lock_lock(&lock);
+        NSMapInsert(names, name, (__bridge void *)retVal);
+        os_unfair_lock_unlock(&lock);
+    }
+
+    return retVal;
+}
+
+static void sproutLogDeferredMessage(uint32_t flag, intptr_t context, const char *file, const char *function, unsigned int line,
+                                     SproutDeferredLogMessageString *message)
+{
+    DDLogLevel level = (DDLogLevel)(SproutLogLevelCurrent() & SPROUT_LOG_LEVEL_MASK);
+    DDLogMessage *logMessage = [[DDLogMessage alloc] initWithMessage:message
+                                                               level:level
+                                                                flag:(DDLogFlag)flag
+                                                             context:context
+                                                                file:sproutInternedName(file)
+                                                            function:sproutInternedName(function)
+                                                                line:line
+                                                                 tag:SproutLogTag(nil)
+                                                             options:DDLogMessageDontCopyMessage
+                                                           timestamp:nil];
+
+    //Errors are logged synchronously, as `DDLogError` is
+    [DDLog log:(flag != DDLogFlagError) message:logMessage];
+}
+
+void SproutLogArgumentsLog(uint32_t flag, intptr_t context, const char *file, const char *function, unsigned int line,
+                           const char *format, const uint8_t *arguments, size_t length)
+{
+    sproutLogDeferredMessage(flag, context, file, function, line, [SproutDeferredLogMessageString messageWithFormat:format bytes:arguments length:length]);
+}
+
+void SproutLogTextLog(uint32_t flag, intptr_t context, const char *file, const char *function, unsigned int line,
+                      const char *text, size_t length)
+{
+    sproutLogDeferredMessage(flag, context, file, function, line, [SproutDeferredLogMessageString messageWithFormat:NULL bytes:text length:length]);
+}
@@ -0,0 +1,212 @@
+//
+//  SproutLogBuffer.h
+//
+//  Part of "Sprout" https://github.com/levigroker/Sprout
+//
+//  Created on October 19, 2026.
+//  Copyright (c) 2026 Levi Brown <mailto:levigroker@gmail.com> This work is
+//  licensed under the Creative Commons Attribution 4.0 International License. To
+//  view a copy of this license, visit https://creativecommons.org/licenses/by/4.0/
+//  or send a letter to Creative Commons, PO Box 1866, Mountain View, CA 94042, USA.
+//
+//  The above attribution and the included license must accompany any version of
+//  the source code, binary distributable, or derivatives.
+//
+
+/**
+ A growable byte buffer for log formatters to render into, starting out on the stack.
+ Rendering a message into a `SproutLogBuffer` and making a single string from it at the end avoids the intermediate
+ strings (and the format parsing) of building the output with `stringWithFormat:`.
+
+ Usage:
+
+     SproutLogBuffer buffer;
+     SproutLogBufferInit(&buffer);
+     SproutLogBufferAppendString(&buffer, logMessage->_message);
+     ...
+     return SproutLogBufferCopyString(&buffer); //Also frees any heap storage
+ */
+
+#ifndef _SPROUT_LOG_BUFFER_H
+#define _SPROUT_LOG_BUFFER_H
+
+#import <Foundation/Foundation.h>
+
+#include <stdlib.h>
+#include <string.h>
+
+#define SPROUT_LOG_BUFFER_STACK_CAPACITY 1024
+
+typedef struct
+{
+    uint8_t *bytes;
+    size_t length;
+    size_t capacity;
+    uint8_t stack[SPROUT_LOG_BUFFER_STACK_CAPACITY];
+} SproutLogBuffer;
+
+static inline void SproutLogBufferInit(SproutLogBuffer *buffer)
+{
+    buffer->bytes = buffer->stack;
+    buffer->length = 0;
+    buffer->capacity = SPROUT_LOG_BUFFER_STACK_CAPACITY;
+}
+
+static inline void SproutLogBufferFree(SproutLogBuffer *buffer)
+{
+    if (buffer->bytes != buffer->stack)
+    {
+        free(buffer->bytes);
+    }
+    SproutLogBufferInit(buffer);
+}
+
+/**
+ Ensures there is room for `length` more bytes.
+ @return A pointer to where those bytes go. The caller must still add them to `buffer->length`.
+ */
+static inline uint8_t *SproutLogBufferReserve(SproutLogBuffer *buffer, size_t length)
+{
+    if (buffer->length + length > buffer->capacity)
+    {
+        size_t capacity = buffer->capacity * 2;
+        while (capacity < buffer->length + length)
+        {
+            capacity *= 2;
+        }
+
+        if (buffer->bytes == buffer->stack)
+        {
+            uint8_t *bytes = malloc(capacity);
+            memcpy(bytes, buffer->stack, buffer->length);
+            buffer->bytes = bytes;
+        }
+        else
+        {
+            buffer->bytes = realloc(buffer->bytes, capacity);
+        }
+        buffer->capacity = capacity;
+    }
+
+    return buffer->bytes + buffer->length;
+}
+
+static inline void SproutLogBufferAppendBytes(SproutLogBuffer *buffer, const void *bytes, size_t length)
+{
+    memcpy(SproutLogBufferReserve(buffer, length), bytes, length);
+    buffer->length += length;
+}
+
+static inline void SproutLogBufferAppendByte(SproutLogBuffer *buffer, uint8_t byte)
+{
+    *SproutLogBufferReserve(buffer, 1) = byte;
+    buffer->length += 1;
+}
+
+static inline void SproutLogBufferAppendCString(SproutLogBuffer *buffer, const char *string)
+{
+    SproutLogBufferAppendBytes(buffer, string, strlen(string));
+}
+
+static inline void SproutLogBufferAppendInteger(SproutLogBuffer *buffer, int64_t value)
+{
+    char digits[24];
+    size_t count = 0;
+    uint64_t magnitude = value < 0 ? (uint64_t)0 - (uint64_t)value : (uint64_t)value;
+
+    do
+    {
+        digits[sizeof(digits) - ++count] = (char)('0' + magnitude % 10);
+        magnitude /= 10;
+    } while (magnitude > 0);
+
+    if (value < 0)
+    {
+        digits[sizeof(digits) - ++count] = '-';
+    }
+
+    SproutLogBufferAppendBytes(buffer, digits + sizeof(digits) - count, count);
+}
+
+/**
+ Appends an unsigned integer padded with leading zeros to (at least) the given width.
+ */
+static inline void SproutLogBufferAppendPaddedInteger(SproutLogBuffer *buffer, uint64_t value, size_t width)
+{
+    char digits[24];
+    size_t count = 0;
+
+    do
+    {
+        digits[sizeof(digits) - ++count] = (char)('0' + value % 10);
+        value /= 10;
+    } while (value > 0 || count < width);
+
+    SproutLogBufferAppendBytes(buffer, digits + sizeof(digits) - count, count);
+}
+
+/**
+ Calls `block` with the UTF-8 bytes of `string`, without copying them when the string can provide them directly.
+ */
+static inline void SproutLogBufferWithUTF8(NSString *string, void (^NS_NOESCAPE block)(const uint8_t *bytes, size_t length))
+{
+    CFStringRef cfString = (__bridge CFStringRef)string;
+    if (!cfString)
+    {
+        block((const uint8_t *)"", 0);
+        return;
+    }
+
+    const char *cString = CFStringGetCStringPtr(cfString, kCFStringEncodingUTF8);
+    if (cString)
+    {
+        block((const uint8_t *)cString, strlen(cString));
+        return;
+    }
+
+    CFIndex length = CFStringGetLength(cfString);
+    CFIndex maximumLength = CFStringGetMaximumSizeForEncoding(length, kCFStringEncodingUTF8);
+    uint8_t stack[SPROUT_LOG_BUFFER_STACK_CAPACITY];
+    uint8_t *bytes = maximumLength <= (CFIndex)sizeof(stack) ? stack : malloc((size_t)maximumLength);
+    CFIndex usedLength = 0;
+    CFStringGetBytes(cfString, CFRangeMake(0, length), kCFStringEncodingUTF8, '?', false, bytes, maximumLength, &usedLength);
+
+    block(bytes, (size_t)usedLength);
+
+    if (bytes != stack)
+    {
+        free(bytes);
+    }
+}
+
+static inline void SproutLogBufferAppendString(SproutLogBuffer *buffer, NSString *string)
+{
+    SproutLogBufferWithUTF8(string, ^(const uint8_t *bytes, size_t length) {
+        SproutLogBufferAppendBytes(buffer, bytes, length);
+    });
+}
+
+/**
+ @return A string with the contents of the buffer. The buffer's storage is freed (or handed to the string).
+ */
+static inline NSString *SproutLogBufferCopyString(SproutLogBuffer *buffer)
+{
+    NSString *retVal = nil;
+    if (buffer->bytes == buffer->stack)
+    {
+        retVal = [[NSString alloc] initWithBytes:buffer->bytes length:buffer->length encoding:NSUTF8StringEncoding];
+    }
+    else
+    {
+        retVal = [[NSString alloc] initWithBytesNoCopy:buffer->bytes length:buffer->length encoding:NSUTF8StringEncoding freeWhenDone:YES];
+        if (!retVal)
+        {
+            free(buffer->bytes);
+        }
+    }
+
+    SproutLogBufferInit(buffer);
+    return retVal;
+}
+
+#endif /* _SPROUT_LOG_BUFFER_H */
@@ -0,0 +1,100 @@
+//
+//  SproutLogCallSites.h
+//
+//  Part of "Sprout" https://github.com/levigroker/Sprout
+//
+//  Created on October 19, 2026.
+//  Copyright (c) 2026 Levi Brown <mailto:levigroker@gmail.com> This work is
+//  licensed under the Creative Commons Attribution 4.0 International License. To
+//  view a copy of this license, visit https://creativecommons.org/licenses/by/4.0/
+//  or send a letter to Creative Commons, PO Box 1866, Mountain View, CA 94042, USA.
+//
+//  The above attribution and the included license must accompany any version of
+//  the source code, binary distributable, or derivatives.
+//
+
+/**
+ Per-statement ("call site") enablement, so individual log statements can be switched on or off at runtime, like the
+ Linux kernel's dynamic debug. This header is plain C.
+
+ Each `DDLog...` and `SproutLog...` statement (see `SPROUT_LOG_ENABLED` in SproutLogMacros.h) has a static
+ `SproutLogCallSite`, placed in its own section of the binary, so all the call sites can be listed without registering
+ them as they run. A call site in the default state follows the log levels. A call site switched on is logged, and one
+ switched off isn't, whatever the log levels. Checking a call site's state is one load and a branch.
+
+ Call sites are not used when `SPROUT_DISABLE_DYNAMIC_LOG_LEVEL` or `SPROUT_DISABLE_LOG_CALL_SITES` is defined.
+ */
+
+#ifndef _SPROUT_LOG_CALL_SITES_H
+#define _SPROUT_LOG_CALL_SITES_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "SproutLogLevels.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef enum
+{
+    SproutLogCallSiteStateDefault = 0,
+    SproutLogCallSiteStateEnabled = 1,
+    SproutLogCallSiteStateDisabled = 2,
+} SproutLogCallSiteState;
+
+typedef struct
+{
+    //A `SproutLogCallSiteState`, only changed with `SproutLogCallSitesSetState`
+    uint8_t state;
+    //The `DDLogFlag` of the statement
+    uint8_t flag;
+    uint32_t line;
+    const char *file;
+    const char *function;
+} SproutLogCallSite;
+
+#ifdef __APPLE__
+    #define SPROUT_LOG_CALL_SITE_SEGMENT "__DATA"
+    #define SPROUT_LOG_CALL_SITE_SECTION_NAME "__sprout_sites"
+    #define SPROUT_LOG_CALL_SITE_SECTION __attribute__((used, section(SPROUT_LOG_CALL_SITE_SEGMENT "," SPROUT_LOG_CALL_SITE_SECTION_NAME), aligned(8)))
+#else
+    //Call sites can still be switched, but not listed
+    #define SPROUT_LOG_CALL_SITE_SECTION __attribute__((used))
+#endif
+
+/**
+ @return `true` if the statement at the call site should be logged: the call site's state if it has been switched,
+ otherwise the log levels.
+ */
+static inline bool SproutLogCallSiteIsEnabled(SproutLogCallSite *site, uint32_t state, uint32_t flag, intptr_t context, const char *module)
+{
+    uint8_t siteState = __atomic_load_n(&site->state, __ATOMIC_RELAXED);
+    if (__builtin_expect(siteState != SproutLogCallSiteStateDefault, 0))
+    {
+        return siteState == SproutLogCallSiteStateEnabled;
+    }
+    return SproutLogLevelIsEnabled(state, flag, context, module);
+}
+
+/**
+ Calls `callback` for every call site in the loaded images.
+ */
+void SproutLogCallSitesEnumerate(void (*callback)(SproutLogCallSite *site, void *info), void *info);
+
+/**
+ Sets the state of the matching call sites.
+ @param file The call site's source file: a file name (i.e. "MyViewController.m") or a full path, or `NULL` for any file.
+ @param function The call site's function (i.e. "-[MyViewController viewDidLoad]"), or `NULL` for any function.
+ @param line The call site's line, or zero for any line.
+ @return The number of call sites matched.
+ */
+size_t SproutLogCallSitesSetState(const char *file, const char *function, uint32_t line, SproutLogCallSiteState state);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _SPROUT_LOG_CALL_SITES_H */
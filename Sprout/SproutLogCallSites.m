@@ -0,0 +1,87 @@
+//
+//  SproutLogCallSites.m
+//
+//  Part of "Sprout" https://github.com/levigroker/Sprout
+//
+//  Created on October 19, 2026.
+//  Copyright (c) 2026 Levi Brown <mailto:levigroker@gmail.com> This work is
+//  licensed under the Creative Commons Attribution 4.0 International License. To
+//  view a copy of this license, visit https://creativecommons.org/licenses/by/4.0/
+//  or send a letter to Creative Commons, PO Box 1866, Mountain View, CA 94042, USA.
+//
+//  The above attribution and the included license must accompany any version of
+//  the source code, binary distributable, or derivatives.
+//
+
+#include <mach-o/dyld.h>
+#include <mach-o/getsect.h>
+#include <string.h>
+
+#import "SproutLogCallSites.h"
+
+#if __LP64__
+typedef struct mach_header_64 sprout_mach_header;
+#else
+typedef struct mach_header sprout_mach_header;
+#endif
+
+typedef struct
+{
+    const char *file;
+    const char *function;
+    uint32_t line;
+    SproutLogCallSiteState state;
+    size_t count;
+} SproutLogCallSiteMatch;
+
+//Whether `file` is `name`, or a path to a file named `name`
+static bool sproutFileMatches(const char *file, const char *name)
+{
+    if (strcmp(file, name) == 0)
+    {
+        return true;
+    }
+
+    const char *fileName = strrchr(file, '/');
+    return fileName && strcmp(fileName + 1, name) == 0;
+}
+
+static void sproutSetStateIfMatches(SproutLogCallSite *site, void *info)
+{
+    SproutLogCallSiteMatch *match = info;
+
+    if ((match->line == 0 || site->line == match->line)
+        && (!match->function || (site->function && strcmp(site->function, match->function) == 0))
+        && (!match->file || (site->file && sproutFileMatches(site->file, match->file))))
+    {
+        __atomic_store_n(&site->state, (uint8_t)match->state, __ATOMIC_RELAXED);
+        match->count++;
+    }
+}
+
+void SproutLogCallSitesEnumerate(void (*callback)(SproutLogCallSite *site, void *info), void *info)
+{
+    uint32_t imageCount = _dyld_image_count();
+    for (uint32_t i = 0; i < imageCount; ++i)
+    {
+        const sprout_mach_header *header = (const sprout_mach_header *)_dyld_get_image_header(i);
+        if (!header)
+        {
+            continue;
+        }
+
+        unsigned long size = 0;
+        SproutLogCallSite *sites = (SproutLogCallSite *)getsectiondata(header, SPROUT_LOG_CALL_SITE_SEGMENT, SPROUT_LOG_CALL_SITE_SECTION_NAME, &size);
+        for (size_t s = 0; sites && s < size / sizeof(SproutLogCallSite); ++s)
+        {
+            callback(&sites[s], info);
+        }
+    }
+}
+
+size_t SproutLogCallSitesSetState(const char *file, const char *function, uint32_t line, SproutLogCallSiteState state)
+{
+    SproutLogCallSiteMatch match = { file, function, line, state, 0 };
+    SproutLogCallSitesEnumerate(sproutSetStateIfMatches, &match);
+    return match.count;
+}
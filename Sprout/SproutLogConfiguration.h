@@ -0,0 +1,85 @@
+//
+//  SproutLogConfiguration.h
+//
+//  Part of "Sprout" https://github.com/levigroker/Sprout
+//
+//  Created on October 19, 2026.
+//  Copyright (c) 2026 Levi Brown <mailto:levigroker@gmail.com> This work is
+//  licensed under the Creative Commons Attribution 4.0 International License. To
+//  view a copy of this license, visit https://creativecommons.org/licenses/by/4.0/
+//  or send a letter to Creative Commons, PO Box 1866, Mountain View, CA 94042, USA.
+//
+//  The above attribution and the included license must accompany any version of
+//  the source code, binary distributable, or derivatives.
+//
+
+#import <Foundation/Foundation.h>
+#import <CocoaLumberjack/CocoaLumberjack.h>
+
+NS_ASSUME_NONNULL_BEGIN
+
+extern NSString * const SproutLogConfigurationErrorDomain;
+
+typedef NS_ENUM(NSInteger, SproutLogConfigurationError)
+{
+    SproutLogConfigurationErrorInvalidFormat = 1,
+    SproutLogConfigurationErrorInvalidLogLevel = 2,
+};
+
+/**
+ An immutable logging configuration, read from a property list or JSON file of the form:
+
+     {
+         "level": "warning",
+         "contexts": { "60221413": "info" },
+         "modules": { "MyViewController": "verbose", "Networking": "debug" },
+         "loggers": { "cocoa.lumberjack.osLogger": "error" }
+     }
+
+ Every key is optional. A log level is one of "off", "error", "warning", "info", "debug", "verbose" or "all", or a
+ `DDLogLevel` number. "contexts" and "modules" set the levels of `SproutLogLevels.h`, and "loggers" sets the levels of
+ the installed loggers by their `loggerName`.
+ */
+@interface SproutLogConfiguration : NSObject
+
+/**
+ The global log level, or `nil` to use the default log level.
+ */
+@property (nonatomic, strong, readonly, nullable) NSNumber *logLevel;
+@property (nonatomic, copy, readonly) NSDictionary<NSNumber *, NSNumber *> *contextLogLevels;
+@property (nonatomic, copy, readonly) NSDictionary<NSString *, NSNumber *> *moduleLogLevels;
+@property (nonatomic, copy, readonly) NSDictionary<NSString *, NSNumber *> *loggerLogLevels;
+
+/**
+ Reads a configuration from a property list or JSON file.
+ */
++ (nullable instancetype)configurationWithContentsOfURL:(NSURL *)url error:(NSError **)error;
+
+- (nullable instancetype)initWithDictionary:(NSDictionary *)dictionary error:(NSError **)error NS_DESIGNATED_INITIALIZER;
+- (instancetype)init NS_UNAVAILABLE;
+
+@end
+
+/**
+ Watches a logging configuration file, and calls its handler with a new `SproutLogConfiguration` each time the file's
+ contents change (including when it is created or atomically replaced), or with `nil` when the file is removed.
+ Changes which leave the configuration equal, or which can't be read, are ignored. The handler is called on a private
+ serial queue.
+ */
+@interface SproutLogConfigurationMonitor : NSObject
+
+@property (nonatomic, strong, readonly) NSURL *url;
+
+- (instancetype)initWithURL:(NSURL *)url handler:(void(^)(SproutLogConfiguration * _Nullable configuration))handler NS_DESIGNATED_INITIALIZER;
+- (instancetype)init NS_UNAVAILABLE;
+
+/**
+ Reads the file (calling the handler if it exists), and starts watching it.
+ */
+- (void)start;
+
+- (void)stop;
+
+@end
+
+NS_ASSUME_NONNULL_END
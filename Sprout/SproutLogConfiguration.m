@@ -0,0 +1,351 @@
+//
+//  SproutLogConfiguration.m
+//
+//  Part of "Sprout" https://github.com/levigroker/Sprout
+//
+//  Created on October 19, 2026.
+//  Copyright (c) 2026 Levi Brown <mailto:levigroker@gmail.com> This work is
+//  licensed under the Creative Commons Attribution 4.0 International License. To
+//  view a copy of this license, visit https://creativecommons.org/licenses/by/4.0/
+//  or send a letter to Creative Commons, PO Box 1866, Mountain View, CA 94042, USA.
+//
+//  The above attribution and the included license must accompany any version of
+//  the source code, binary distributable, or derivatives.
+//
+
+#include <ctype.h>
+#include <fcntl.h>
+#include <unistd.h>
+
+#import "SproutLogConfiguration.h"
+
+NSString * const SproutLogConfigurationErrorDomain = @"SproutLogConfigurationErrorDomain";
+
+static NSString * const kConfigurationKeyLevel = @"level";
+static NSString * const kConfigurationKeyContexts = @"contexts";
+static NSString * const kConfigurationKeyModules = @"modules";
+static NSString * const kConfigurationKeyLoggers = @"loggers";
+
+static NSError *sproutConfigurationError(SproutLogConfigurationError code, NSString *description)
+{
+    return [NSError errorWithDomain:SproutLogConfigurationErrorDomain code:code userInfo:@{ NSLocalizedDescriptionKey: description }];
+}
+
+//A level name or number, or `nil` if the value is neither
+static NSNumber *sproutLogLevelForValue(id value)
+{
+    if ([value isKindOfClass:[NSNumber class]])
+    {
+        return value;
+    }
+
+    if (![value isKindOfClass:[NSString class]])
+    {
+        return nil;
+    }
+
+    static NSDictionary<NSString *, NSNumber *> *levels = nil;
+    static dispatch_once_t onceToken;
+    dispatch_once(&onceToken, ^{
+        levels = @{
+            @"off": @(DDLogLevelOff),
+            @"error": @(DDLogLevelError),
+            @"warning": @(DDLogLevelWarning),
+            @"warn": @(DDLogLevelWarning),
+            @"info": @(DDLogLevelInfo),
+            @"debug": @(DDLogLevelDebug),
+            @"verbose": @(DDLogLevelVerbose),
+            @"all": @(DDLogLevelAll),
+        };
+    });
+
+    return levels[[value lowercaseString]];
+}
+
+#pragma mark - SproutLogConfiguration
+
+@implementation SproutLogConfiguration
+
++ (instancetype)configurationWithContentsOfURL:(NSURL *)url error:(NSError *__autoreleasing *)error
+{
+    NSData *data = [NSData dataWithContentsOfURL:url options:0 error:error];
+    if (!data)
+    {
+        return nil;
+    }
+
+    //JSON files start with an object, property lists with "<?xml" or "bplist"
+    const char *bytes = data.bytes;
+    NSUInteger start = 0;
+    while (start < data.length && isspace((unsigned char)bytes[start]))
+    {
+        ++start;
+    }
+
+    id object = nil;
+    if (start < data.length && bytes[start] == '{')
+    {
+        object = [NSJSONSerialization JSONObjectWithData:data options:0 error:error];
+    }
+    else
+    {
+        object = [NSPropertyListSerialization propertyListWithData:data options:NSPropertyListImmutable format:NULL error:error];
+    }
+
+    if (!object)
+    {
+        return nil;
+    }
+
+    if (![object isKindOfClass:[NSDictionary class]])
+    {
+        if (error)
+        {
+            *error = sproutConfigurationError(SproutLogConfigurationErrorInvalidFormat, @"The logging configuration must be a dictionary.");
+        }
+        return nil;
+    }
+
+    return [[self alloc] initWithDictionary:object error:error];
+}
+
+- (instancetype)initWithDictionary:(NSDictionary *)dictionary error:(NSError *__autoreleasing *)error
+{
+    if ((self = [super init]))
+    {
+        id level = dictionary[kConfigurationKeyLevel];
+        if (level)
+        {
+            _logLevel = sproutLogLevelForValue(level);
+            if (!_logLevel)
+            {
+                if (error)
+                {
+                    *error = sproutConfigurationError(SproutLogConfigurationErrorInvalidLogLevel, [NSString stringWithFormat:@"Invalid log level '%@'.", level]);
+                }
+                return nil;
+            }
+        }
+
+        NSDictionary *contextLevels = [self levelsForKey:kConfigurationKeyContexts inDictionary:dictionary error:error];
+        NSDictionary *moduleLevels = [self levelsForKey:kConfigurationKeyModules inDictionary:dictionary error:error];
+        NSDictionary *loggerLevels = [self levelsForKey:kConfigurationKeyLoggers inDictionary:dictionary error:error];
+        if (!contextLevels || !moduleLevels || !loggerLevels)
+        {
+            return nil;
+        }
+
+        NSMutableDictionary<NSNumber *, NSNumber *> *contextLogLevels = [NSMutableDictionary dictionaryWithCapacity:contextLevels.count];
+        for (NSString *context in contextLevels)
+        {
+            contextLogLevels[@([context integerValue])] = contextLevels[context];
+        }
+
+        _contextLogLevels = [contextLogLevels copy];
+        _moduleLogLevels = [moduleLevels copy];
+        _loggerLogLevels = [loggerLevels copy];
+    }
+
+    return self;
+}
+
+- (BOOL)isEqual:(id)object
+{
+    if (![object isKindOfClass:[SproutLogConfiguration class]])
+    {
+        return NO;
+    }
+
+    SproutLogConfiguration *other = object;
+    return (self.logLevel == other.logLevel || [self.logLevel isEqual:other.logLevel])
+        && [self.contextLogLevels isEqualToDictionary:other.contextLogLevels]
+        && [self.moduleLogLevels isEqualToDictionary:other.moduleLogLevels]
+        && [self.loggerLogLevels isEqualToDictionary:other.loggerLogLevels];
+}
+
+- (NSUInteger)hash
+{
+    return self.logLevel.hash ^ self.contextLogLevels.count ^ (self.moduleLogLevels.count << 8) ^ (self.loggerLogLevels.count << 16);
+}
+
+#pragma mark Helpers
+
+//The given dictionary of names to levels, as level numbers (empty if the key is absent), or `nil` if it isn't valid
+- (NSDictionary<NSString *, NSNumber *> *)levelsForKey:(NSString *)key inDictionary:(NSDictionary *)dictionary error:(NSError *__autoreleasing *)error
+{
+    id levels = dictionary[key];
+    if (!levels)
+    {
+        return @{};
+    }
+
+    if (![levels isKindOfClass:[NSDictionary class]])
+    {
+        if (error)
+        {
+            *error = sproutConfigurationError(SproutLogConfigurationErrorInvalidFormat, [NSString stringWithFormat:@"'%@' must be a dictionary.", key]);
+        }
+        return nil;
+    }
+
+    NSMutableDictionary<NSString *, NSNumber *> *retVal = [NSMutableDictionary dictionaryWithCapacity:[levels count]];
+    for (id name in levels)
+    {
+        NSNumber *level = sproutLogLevelForValue(levels[name]);
+        if (!level)
+        {
+            if (error)
+            {
+                *error = sproutConfigurationError(SproutLogConfigurationErrorInvalidLogLevel, [NSString stringWithFormat:@"Invalid log level '%@' for '%@'.", levels[name], name]);
+            }
+            return nil;
+        }
+        retVal[[name description]] = level;
+    }
+
+    return retVal;
+}
+
+@end
+
+#pragma mark - SproutLogConfigurationMonitor
+
+@interface SproutLogConfigurationMonitor ()
+
+@property (nonatomic, copy) void(^handler)(SproutLogConfiguration *configuration);
+@property (nonatomic, strong) dispatch_queue_t monitorQueue;
+//Only accessed on the monitor queue
+@property (nonatomic, strong) dispatch_source_t directorySource;
+@property (nonatomic, strong) dispatch_source_t fileSource;
+@property (nonatomic, strong) SproutLogConfiguration *configuration;
+@property (nonatomic, assign) BOOL loaded;
+
+@end
+
+@implementation SproutLogConfigurationMonitor
+
+- (instancetype)initWithURL:(NSURL *)url handler:(void (^)(SproutLogConfiguration *))handler
+{
+    if ((self = [super init]))
+    {
+        _url = url;
+        _handler = [handler copy];
+        _monitorQueue = dispatch_queue_create("sprout.logconfiguration", dispatch_queue_attr_make_with_qos_class(DISPATCH_QUEUE_SERIAL, QOS_CLASS_UTILITY, 0));
+    }
+
+    return self;
+}
+
+- (void)dealloc
+{
+    if (_directorySource)
+    {
+        dispatch_source_cancel(_directorySource);
+    }
+    if (_fileSource)
+    {
+        dispatch_source_cancel(_fileSource);
+    }
+}
+
+- (void)start
+{
+    dispatch_async(self.monitorQueue, ^{ @autoreleasepool {
+        if (!self.directorySource)
+        {
+            //The directory changes when the file is created, removed or atomically replaced
+            self.directorySource = [self sourceForPath:self.url.URLByDeletingLastPathComponent.path events:DISPATCH_VNODE_WRITE];
+        }
+        [self reload];
+    } });
+}
+
+- (void)stop
+{
+    dispatch_async(self.monitorQueue, ^{
+        if (self.directorySource)
+        {
+            dispatch_source_cancel(self.directorySource);
+            self.directorySource = nil;
+        }
+        if (self.fileSource)
+        {
+            dispatch_source_cancel(self.fileSource);
+            self.fileSource = nil;
+        }
+    });
+}
+
+#pragma mark Helpers
+
+- (void)reload
+{
+    if (!self.fileSource)
+    {
+        //Watches the file's contents being rewritten in place
+        self.fileSource = [self sourceForPath:self.url.path events:DISPATCH_VNODE_WRITE | DISPATCH_VNODE_EXTEND | DISPATCH_VNODE_DELETE | DISPATCH_VNODE_RENAME];
+    }
+
+    SproutLogConfiguration *configuration = nil;
+    if ([[NSFileManager defaultManager] fileExistsAtPath:self.url.path])
+    {
+        configuration = [SproutLogConfiguration configurationWithContentsOfURL:self.url error:NULL];
+        if (!configuration)
+        {
+            //Likely part way through being written. The next change reloads it.
+            return;
+        }
+    }
+
+    if (self.loaded && (configuration == self.configuration || [configuration isEqual:self.configuration]))
+    {
+        return;
+    }
+
+    self.loaded = YES;
+    self.configuration = configuration;
+    if (self.handler)
+    {
+        self.handler(configuration);
+    }
+}
+
+- (dispatch_source_t)sourceForPath:(NSString *)path events:(unsigned long)events
+{
+    int fileDescriptor = open(path.fileSystemRepresentation, O_EVTONLY);
+    if (fileDescriptor < 0)
+    {
+        return nil;
+    }
+
+    dispatch_source_t source = dispatch_source_create(DISPATCH_SOURCE_TYPE_VNODE, (uintptr_t)fileDescriptor, events, self.monitorQueue);
+
+    __weak typeof(self) weakSelf = self;
+    __weak dispatch_source_t weakSource = source;
+    dispatch_source_set_event_handler(source, ^{ @autoreleasepool {
+        SproutLogConfigurationMonitor *strongSelf = weakSelf;
+        dispatch_source_t strongSource = weakSource;
+        if (!strongSelf || !strongSource)
+        {
+            return;
+        }
+
+        if (strongSource == strongSelf.fileSource && (dispatch_source_get_data(strongSource) & (DISPATCH_VNODE_DELETE | DISPATCH_VNODE_RENAME)))
+        {
+            //The file was removed or replaced, so watch whichever file is now at the path
+            dispatch_source_cancel(strongSource);
+            strongSelf.fileSource = nil;
+        }
+
+        [strongSelf reload];
+    } });
+
+    dispatch_source_set_cancel_handler(source, ^{
+        close(fileDescriptor);
+    });
+
+    dispatch_resume(source);
+    return source;
+}
+
+@end
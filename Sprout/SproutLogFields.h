@@ -0,0 +1,190 @@
+//
+//  SproutLogFields.h
+//
+//  Part of "Sprout" https://github.com/levigroker/Sprout
+//
+//  Created on October 19, 2026.
+//  Copyright (c) 2026 Levi Brown <mailto:levigroker@gmail.com> This work is
+//  licensed under the Creative Commons Attribution 4.0 International License. To
+//  view a copy of this license, visit https://creativecommons.org/licenses/by/4.0/
+//  or send a letter to Creative Commons, PO Box 1866, Mountain View, CA 94042, USA.
+//
+//  The above attribution and the included license must accompany any version of
+//  the source code, binary distributable, or derivatives.
+//
+
+/**
+ Structured key/value logging: typed fields which travel with a log message, rather than being formatted into its text.
+
+     SproutLogInfoKV(@"Upload complete", @"bytes", byteCount, @"ms", elapsed, @"host", host);
+
+ Numbers are kept as numbers (and strings as the strings passed) until a logger writes the message: text formatters render
+ them as `key=value` pairs (i.e. `Upload complete bytes=1024 ms=36.5 host=example.com`), `SproutJSONLogFormatter` writes
+ them as a JSON object of native values, and `SproutBinaryFileLogger` writes them in its binary encoding. Nothing is
+ evaluated or allocated if the log level excludes the message.
+
+ Up to eight key/value pairs can be passed. Keys are `NSString`s. Values may be any integer, floating point or boolean type,
+ C strings or objects (`NSString`s and `NSNumber`s are written as is, any other object as its `description`). Strings are
+ copied, and descriptions taken, at the call site, so changes made to a value after it is logged are never seen.
+ String values (and diagnostic context values) go through the stages of a `SproutStagedLogFormatter` (i.e. redaction)
+ along with the message.
+ `BOOL` is a `signed char` on some platforms (i.e. x86_64), where it is indistinguishable from an integer, so wrap `BOOL`
+ values (including `YES` and `NO`) in `SproutKVBool` to log them as booleans everywhere:
+
+     SproutLogInfoKV(@"Upload complete", @"cached", SproutKVBool(cached));
+
+ The fields are the message's tag (`representedObject`), and carry the thread's `SproutDiagnosticContext` along with them.
+ */
+
+#ifndef _SPROUT_LOG_FIELDS_H
+#define _SPROUT_LOG_FIELDS_H
+
+#import <Foundation/Foundation.h>
+#import <CocoaLumberjack/CocoaLumberjack.h>
+
+#import "SproutDiagnosticContext.h"
+#import "SproutLogMacros.h"
+#import "SproutLogBuffer.h"
+
+#define SPROUT_LOG_FIELDS_MAXIMUM_COUNT 8
+
+//Values match `SproutBinaryLogFieldType`
+typedef NS_ENUM(uint8_t, SproutLogFieldType)
+{
+    SproutLogFieldTypeInteger = 1,
+    SproutLogFieldTypeUnsigned = 2,
+    SproutLogFieldTypeDouble = 3,
+    SproutLogFieldTypeBool = 4,
+    SproutLogFieldTypeObject = 5,
+};
+
+@interface SproutLogFields : NSObject
+
+@property (nonatomic, assign, readonly) NSUInteger count;
+
+/**
+ The diagnostic context of the thread the fields were created on, or `nil`.
+ */
+@property (nonatomic, strong, readonly) SproutDiagnosticContext *diagnosticContext;
+
+/**
+ @return New, empty fields capturing the current thread's diagnostic context.
+ */
++ (instancetype)fields;
+
+- (NSString *)keyAtIndex:(NSUInteger)index;
+- (SproutLogFieldType)typeAtIndex:(NSUInteger)index;
+- (int64_t)integerValueAtIndex:(NSUInteger)index;
+- (uint64_t)unsignedValueAtIndex:(NSUInteger)index;
+- (double)doubleValueAtIndex:(NSUInteger)index;
+- (BOOL)boolValueAtIndex:(NSUInteger)index;
+- (id)objectValueAtIndex:(NSUInteger)index;
+
+/**
+ @return The fields as `key=value` pairs separated by spaces. Values which contain spaces, quotes or `=` are quoted.
+ Rendered once, when first asked for.
+ */
+@property (nonatomic, copy, readonly) NSString *renderedString;
+
+/**
+ @param block Processes a string value (i.e. redacts it), returning the given value if there is nothing to change.
+ @return Fields with the string values (and the values of the `diagnosticContext`) processed by the block, or these fields
+ if it changed nothing.
+ */
+- (SproutLogFields *)fieldsByProcessingStringValues:(NSString *(^NS_NOESCAPE)(NSString *value))block;
+
+@end
+
+//Used by the `SproutLog...KV` macros. Fields beyond `SPROUT_LOG_FIELDS_MAXIMUM_COUNT` are ignored.
+extern void SproutLogFieldsAddInteger(SproutLogFields *fields, NSString *key, long long value);
+extern void SproutLogFieldsAddUnsigned(SproutLogFields *fields, NSString *key, unsigned long long value);
+extern void SproutLogFieldsAddDouble(SproutLogFields *fields, NSString *key, double value);
+extern void SproutLogFieldsAddBool(SproutLogFields *fields, NSString *key, bool value);
+extern void SproutLogFieldsAddCString(SproutLogFields *fields, NSString *key, const char *value);
+extern void SproutLogFieldsAddObject(SproutLogFields *fields, NSString *key, id value);
+
+/**
+ @return The fields logged with the message, or `nil`.
+ */
+static inline SproutLogFields *SproutLogMessageFields(DDLogMessage *logMessage)
+{
+    id tag = logMessage->_representedObject;
+    return [tag isKindOfClass:[SproutLogFields class]] ? tag : nil;
+}
+
+/**
+ @return The diagnostic context captured by the message (directly, or with its fields), or `nil`.
+ */
+static inline SproutDiagnosticContext *SproutLogMessageDiagnosticContext(DDLogMessage *logMessage)
+{
+    id tag = logMessage->_representedObject;
+    if ([tag isKindOfClass:[SproutDiagnosticContext class]])
+    {
+        return tag;
+    }
+    return [tag isKindOfClass:[SproutLogFields class]] ? [(SproutLogFields *)tag diagnosticContext] : nil;
+}
+
+#pragma mark - Macros
+
+/**
+ Logs the value as a boolean (`true` or `false`) rather than an integer, whatever the platform's `BOOL` type.
+ */
+#define SproutKVBool(value) ((bool)(value))
+
+#define SproutLogErrorKV(message, ...)   SPROUT_LOG_KV(NO,                DDLogFlagError,   message, __VA_ARGS__)
+#define SproutLogWarnKV(message, ...)    SPROUT_LOG_KV(LOG_ASYNC_ENABLED, DDLogFlagWarning, message, __VA_ARGS__)
+#define SproutLogInfoKV(message, ...)    SPROUT_LOG_KV(LOG_ASYNC_ENABLED, DDLogFlagInfo,    message, __VA_ARGS__)
+#define SproutLogDebugKV(message, ...)   SPROUT_LOG_KV(LOG_ASYNC_ENABLED, DDLogFlagDebug,   message, __VA_ARGS__)
+#define SproutLogVerboseKV(message, ...) SPROUT_LOG_KV(LOG_ASYNC_ENABLED, DDLogFlagVerbose, message, __VA_ARGS__)
+
+#define SPROUT_LOG_KV(async, flg, message, ...)                                                  \
+        do {                                                                                     \
+            if (SPROUT_LOG_ENABLED(LOG_LEVEL_DEF, flg, 0, __PRETTY_FUNCTION__))                  \
+            {                                                                                    \
+                SproutLogFields *sproutLogFields = [SproutLogFields fields];                     \
+                SPROUT_LOG_KV_ADD(sproutLogFields, __VA_ARGS__)                                  \
+                LOG_MACRO(async, LOG_LEVEL_DEF, flg, 0, sproutLogFields, __PRETTY_FUNCTION__, @"%@", message); \
+            }                                                                                    \
+        } while (0)
+
+//Picks the adder for the number of arguments, which must be (up to eight) key/value pairs
+#define SPROUT_LOG_KV_ADD(fields, ...) \
+        SPROUT_LOG_KV_PICK(__VA_ARGS__, SPROUT_LOG_KV_8, SPROUT_LOG_KV_ODD, SPROUT_LOG_KV_7, SPROUT_LOG_KV_ODD, \
+                           SPROUT_LOG_KV_6, SPROUT_LOG_KV_ODD, SPROUT_LOG_KV_5, SPROUT_LOG_KV_ODD, \
+                           SPROUT_LOG_KV_4, SPROUT_LOG_KV_ODD, SPROUT_LOG_KV_3, SPROUT_LOG_KV_ODD, \
+                           SPROUT_LOG_KV_2, SPROUT_LOG_KV_ODD, SPROUT_LOG_KV_1, SPROUT_LOG_KV_ODD)(fields, __VA_ARGS__)
+#define SPROUT_LOG_KV_PICK(_1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, _16, NAME, ...) NAME
+
+#define SPROUT_LOG_KV_ODD(fields, ...) _Static_assert(0, "SproutLog...KV expects key/value pairs");
+#define SPROUT_LOG_KV_1(fields, key, value)      SPROUT_LOG_KV_SET(fields, key, value);
+#define SPROUT_LOG_KV_2(fields, key, value, ...) SPROUT_LOG_KV_SET(fields, key, value); SPROUT_LOG_KV_1(fields, __VA_ARGS__)
+#define SPROUT_LOG_KV_3(fields, key, value, ...) SPROUT_LOG_KV_SET(fields, key, value); SPROUT_LOG_KV_2(fields, __VA_ARGS__)
+#define SPROUT_LOG_KV_4(fields, key, value, ...) SPROUT_LOG_KV_SET(fields, key, value); SPROUT_LOG_KV_3(fields, __VA_ARGS__)
+#define SPROUT_LOG_KV_5(fields, key, value, ...) SPROUT_LOG_KV_SET(fields, key, value); SPROUT_LOG_KV_4(fields, __VA_ARGS__)
+#define SPROUT_LOG_KV_6(fields, key, value, ...) SPROUT_LOG_KV_SET(fields, key, value); SPROUT_LOG_KV_5(fields, __VA_ARGS__)
+#define SPROUT_LOG_KV_7(fields, key, value, ...) SPROUT_LOG_KV_SET(fields, key, value); SPROUT_LOG_KV_6(fields, __VA_ARGS__)
+#define SPROUT_LOG_KV_8(fields, key, value, ...) SPROUT_LOG_KV_SET(fields, key, value); SPROUT_LOG_KV_7(fields, __VA_ARGS__)
+
+//Picks the typed adder for the value, so scalars are stored as scalars
+#define SPROUT_LOG_KV_SET(fields, key, value)                   \
+        _Generic((value),                                       \
+            bool: SproutLogFieldsAddBool,                       \
+            char: SproutLogFieldsAddInteger,                    \
+            signed char: SproutLogFieldsAddInteger,             \
+            short: SproutLogFieldsAddInteger,                   \
+            int: SproutLogFieldsAddInteger,                     \
+            long: SproutLogFieldsAddInteger,                    \
+            long long: SproutLogFieldsAddInteger,               \
+            unsigned char: SproutLogFieldsAddUnsigned,          \
+            unsigned short: SproutLogFieldsAddUnsigned,         \
+            unsigned int: SproutLogFieldsAddUnsigned,           \
+            unsigned long: SproutLogFieldsAddUnsigned,          \
+            unsigned long long: SproutLogFieldsAddUnsigned,     \
+            float: SproutLogFieldsAddDouble,                    \
+            double: SproutLogFieldsAddDouble,                   \
+            char *: SproutLogFieldsAddCString,                  \
+            const char *: SproutLogFieldsAddCString,            \
+            default: SproutLogFieldsAddObject)((fields), (key), (value))
+
+#endif /* _SPROUT_LOG_FIELDS_H */
@@ -0,0 +1,351 @@
+//
+//  SproutLogFields.m
+//
+//  Part of "Sprout" https://github.com/levigroker/Sprout
+//
+//  Created on October 19, 2026.
+//  Copyright (c) 2026 Levi Brown <mailto:levigroker@gmail.com> This work is
+//  licensed under the Creative Commons Attribution 4.0 International License. To
+//  view a copy of this license, visit https://creativecommons.org/licenses/by/4.0/
+//  or send a letter to Creative Commons, PO Box 1866, Mountain View, CA 94042, USA.
+//
+//  The above attribution and the included license must accompany any version of
+//  the source code, binary distributable, or derivatives.
+//
+
+#include <math.h>
+#include <os/lock.h>
+#include <stdio.h>
+
+#import "SproutLogFields.h"
+
+typedef struct
+{
+    //Retained
+    const void *key;
+    SproutLogFieldType type;
+    union
+    {
+        int64_t integer;
+        uint64_t unsignedInteger;
+        double doubleValue;
+        //Retained
+        const void *object;
+    } value;
+} SproutLogField;
+
+@interface SproutLogFields ()
+{
+    SproutLogField _fields[SPROUT_LOG_FIELDS_MAXIMUM_COUNT];
+    os_unfair_lock _renderLock;
+    NSString *_renderedString;
+}
+
+@property (nonatomic, assign) NSUInteger count;
+@property (nonatomic, strong) SproutDiagnosticContext *diagnosticContext;
+
+- (SproutLogField *)addFieldWithKey:(NSString *)key type:(SproutLogFieldType)type;
+
+@end
+
+#pragma mark - Adders
+
+void SproutLogFieldsAddInteger(SproutLogFields *fields, NSString *key, long long value)
+{
+    SproutLogField *field = [fields addFieldWithKey:key type:SproutLogFieldTypeInteger];
+    if (field)
+    {
+        field->value.integer = value;
+    }
+}
+
+void SproutLogFieldsAddUnsigned(SproutLogFields *fields, NSString *key, unsigned long long value)
+{
+    SproutLogField *field = [fields addFieldWithKey:key type:SproutLogFieldTypeUnsigned];
+    if (field)
+    {
+        field->value.unsignedInteger = value;
+    }
+}
+
+void SproutLogFieldsAddDouble(SproutLogFields *fields, NSString *key, double value)
+{
+    SproutLogField *field = [fields addFieldWithKey:key type:SproutLogFieldTypeDouble];
+    if (field)
+    {
+        field->value.doubleValue = value;
+    }
+}
+
+void SproutLogFieldsAddBool(SproutLogFields *fields, NSString *key, bool value)
+{
+    SproutLogField *field = [fields addFieldWithKey:key type:SproutLogFieldTypeBool];
+    if (field)
+    {
+        field->value.integer = value ? 1 : 0;
+    }
+}
+
+void SproutLogFieldsAddCString(SproutLogFields *fields, NSString *key, const char *value)
+{
+    SproutLogFieldsAddObject(fields, key, value ? [NSString stringWithUTF8String:value] : nil);
+}
+
+void SproutLogFieldsAddObject(SproutLogFields *fields, NSString *key, id value)
+{
+    //Numbers are stored as scalars
+    if (value == (id)kCFBooleanTrue || value == (id)kCFBooleanFalse)
+    {
+        SproutLogFieldsAddBool(fields, key, value == (id)kCFBooleanTrue);
+        return;
+    }
+    if ([value isKindOfClass:[NSNumber class]])
+    {
+        NSNumber *number = value;
+        if (CFNumberIsFloatType((__bridge CFNumberRef)number))
+        {
+            SproutLogFieldsAddDouble(fields, key, number.doubleValue);
+        }
+        else if (number.objCType[0] == 'Q' && number.unsignedLongLongValue > INT64_MAX)
+        {
+            SproutLogFieldsAddUnsigned(fields, key, number.unsignedLongLongValue);
+        }
+        else
+        {
+            SproutLogFieldsAddInteger(fields, key, number.longLongValue);
+        }
+        return;
+    }
+
+    SproutLogField *field = [fields addFieldWithKey:key type:SproutLogFieldTypeObject];
+    if (field)
+    {
+        //Taken now, as the caller may change (or mutate) the value before a logger writes it, on another thread
+        NSString *text = [value isKindOfClass:[NSString class]] ? value : [value description];
+        field->value.object = text ? CFBridgingRetain([text copy]) : NULL;
+    }
+}
+
+#pragma mark - Rendering
+
+//Writes the value as is, or quoted if it would otherwise be ambiguous
+static void sproutAppendFieldText(SproutLogBuffer *buffer, NSString *text)
+{
+    SproutLogBufferWithUTF8(text, ^(const uint8_t *bytes, size_t length) {
+        BOOL needsQuotes = length == 0;
+        for (size_t i = 0; i < length && !needsQuotes; ++i)
+        {
+            needsQuotes = bytes[i] <= ' ' || bytes[i] == '"' || bytes[i] == '=' || bytes[i] == '\\';
+        }
+
+        if (!needsQuotes)
+        {
+            SproutLogBufferAppendBytes(buffer, bytes, length);
+            return;
+        }
+
+        SproutLogBufferAppendByte(buffer, '"');
+        for (size_t i = 0; i < length; ++i)
+        {
+            uint8_t byte = bytes[i];
+            if (byte == '"' || byte == '\\')
+            {
+                SproutLogBufferAppendByte(buffer, '\\');
+                SproutLogBufferAppendByte(buffer, byte);
+            }
+            else if (byte == '\n')
+            {
+                SproutLogBufferAppendBytes(buffer, "\\n", 2);
+            }
+            else
+            {
+                SproutLogBufferAppendByte(buffer, byte);
+            }
+        }
+        SproutLogBufferAppendByte(buffer, '"');
+    });
+}
+
+@implementation SproutLogFields
+
++ (instancetype)fields
+{
+    SproutLogFields *retVal = [[self alloc] init];
+    retVal.diagnosticContext = SproutDiagnosticContextCurrent();
+    return retVal;
+}
+
+- (instancetype)init
+{
+    if ((self = [super init]))
+    {
+        _renderLock = OS_UNFAIR_LOCK_INIT;
+    }
+
+    return self;
+}
+
+- (void)dealloc
+{
+    for (NSUInteger i = 0; i < _count; ++i)
+    {
+        if (_fields[i].key)
+        {
+            CFRelease(_fields[i].key);
+        }
+        if (_fields[i].type == SproutLogFieldTypeObject && _fields[i].value.object)
+        {
+            CFRelease(_fields[i].value.object);
+        }
+    }
+}
+
+- (SproutLogField *)addFieldWithKey:(NSString *)key type:(SproutLogFieldType)type
+{
+    if (_count >= SPROUT_LOG_FIELDS_MAXIMUM_COUNT)
+    {
+        return NULL;
+    }
+
+    SproutLogField *retVal = &_fields[_count++];
+    retVal->key = CFBridgingRetain([key copy] ?: @"");
+    retVal->type = type;
+    return retVal;
+}
+
+#pragma mark Accessors
+
+- (NSString *)keyAtIndex:(NSUInteger)index
+{
+    return index < _count ? (__bridge NSString *)_fields[index].key : nil;
+}
+
+- (SproutLogFieldType)typeAtIndex:(NSUInteger)index
+{
+    return index < _count ? _fields[index].type : 0;
+}
+
+- (int64_t)integerValueAtIndex:(NSUInteger)index
+{
+    return index < _count ? _fields[index].value.integer : 0;
+}
+
+- (uint64_t)unsignedValueAtIndex:(NSUInteger)index
+{
+    return index < _count ? _fields[index].value.unsignedInteger : 0;
+}
+
+- (double)doubleValueAtIndex:(NSUInteger)index
+{
+    return index < _count ? _fields[index].value.doubleValue : 0.0;
+}
+
+- (BOOL)boolValueAtIndex:(NSUInteger)index
+{
+    return index < _count && _fields[index].value.integer != 0;
+}
+
+- (id)objectValueAtIndex:(NSUInteger)index
+{
+    return index < _count && _fields[index].type == SproutLogFieldTypeObject ? (__bridge id)_fields[index].value.object : nil;
+}
+
+- (NSString *)renderedString
+{
+    os_unfair_lock_lock(&_renderLock);
+    if (!_renderedString)
+    {
+        SproutLogBuffer buffer;
+        SproutLogBufferInit(&buffer);
+
+        for (NSUInteger i = 0; i < _count; ++i)
+        {
+            const SproutLogField *field = &_fields[i];
+            if (i > 0)
+            {
+                SproutLogBufferAppendByte(&buffer, ' ');
+            }
+            SproutLogBufferAppendString(&buffer, (__bridge NSString *)field->key);
+            SproutLogBufferAppendByte(&buffer, '=');
+
+            switch (field->type)
+            {
+                case SproutLogFieldTypeInteger:
+                    SproutLogBufferAppendInteger(&buffer, field->value.integer);
+                    break;
+                case SproutLogFieldTypeUnsigned:
+                {
+                    char digits[24];
+                    int length = snprintf(digits, sizeof(digits), "%llu", (unsigned long long)field->value.unsignedInteger);
+                    SproutLogBufferAppendBytes(&buffer, digits, (size_t)length);
+                    break;
+                }
+                case SproutLogFieldTypeDouble:
+                {
+                    char digits[32];
+                    int length = snprintf(digits, sizeof(digits), "%.15g", field->value.doubleValue);
+                    SproutLogBufferAppendBytes(&buffer, digits, (size_t)length);
+                    break;
+                }
+                case SproutLogFieldTypeBool:
+                    SproutLogBufferAppendCString(&buffer, field->value.integer ? "true" : "false");
+                    break;
+                case SproutLogFieldTypeObject:
+                {
+                    id object = (__bridge id)field->value.object;
+                    sproutAppendFieldText(&buffer, [object isKindOfClass:[NSString class]] ? object : ([object description] ?: @"(null)"));
+                    break;
+                }
+            }
+        }
+
+        _renderedString = SproutLogBufferCopyString(&buffer);
+    }
+    NSString *retVal = _renderedString;
+    os_unfair_lock_unlock(&_renderLock);
+
+    return retVal;
+}
+
+- (SproutLogFields *)fieldsByProcessingStringValues:(NSString *(^NS_NOESCAPE)(NSString *value))block
+{
+    SproutDiagnosticContext *diagnosticContext = [self.diagnosticContext contextByProcessingValues:block];
+    BOOL changed = diagnosticContext != self.diagnosticContext;
+
+    NSString *values[SPROUT_LOG_FIELDS_MAXIMUM_COUNT] = { nil };
+    for (NSUInteger i = 0; i < _count; ++i)
+    {
+        if (_fields[i].type == SproutLogFieldTypeObject && _fields[i].value.object)
+        {
+            NSString *value = (__bridge NSString *)_fields[i].value.object;
+            values[i] = block(value);
+            changed = changed || values[i] != value;
+        }
+    }
+
+    if (!changed)
+    {
+        return self;
+    }
+
+    SproutLogFields *retVal = [[SproutLogFields alloc] init];
+    retVal.diagnosticContext = diagnosticContext;
+    for (NSUInteger i = 0; i < _count; ++i)
+    {
+        SproutLogField *field = [retVal addFieldWithKey:(__bridge NSString *)_fields[i].key type:_fields[i].type];
+        field->value = _fields[i].value;
+        if (field->type == SproutLogFieldTypeObject)
+        {
+            field->value.object = values[i] ? CFBridgingRetain([values[i] copy]) : NULL;
+        }
+    }
+
+    return retVal;
+}
+
+- (NSString *)description
+{
+    return self.renderedString;
+}
+
+@end
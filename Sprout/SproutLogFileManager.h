@@ -0,0 +1,57 @@
+//
+//  SproutLogFileManager.h
+//
+//  Part of "Sprout" https://github.com/levigroker/Sprout
+//
+//  Created on October 19, 2026.
+//  Copyright (c) 2026 Levi Brown <mailto:levigroker@gmail.com> This work is
+//  licensed under the Creative Commons Attribution 4.0 International License. To
+//  view a copy of this license, visit https://creativecommons.org/licenses/by/4.0/
+//  or send a letter to Creative Commons, PO Box 1866, Mountain View, CA 94042, USA.
+//
+//  The above attribution and the included license must accompany any version of
+//  the source code, binary distributable, or derivatives.
+//
+
+#import <Foundation/Foundation.h>
+#import <CocoaLumberjack/CocoaLumberjack.h>
+
+/**
+ A `DDLogFileManagerDefault` which keeps an in-memory model of its log files rather than listing, inspecting and sorting
+ the logs directory on every call to `sortedLogFileInfos` (and friends).
+
+ The model is loaded in the background when the manager is created, and is then maintained as log files are created,
+ archived and deleted by the manager and its `DDFileLogger`. The logs directory is monitored, so files which are added or
+ removed by anything else are picked up as well.
+
+ Archived log files never change, so their `DDLogFileInfo` objects are shared between calls. The `DDLogFileInfo` of a
+ log file which is still being written to is created afresh for each call, so its size and dates are current.
+ */
+@interface SproutLogFileManager : DDLogFileManagerDefault
+
+/**
+ If `YES` (the default) the next log file is prepared in the background ahead of time (created, with its protection set
+ and its header written) as a hidden "standby" file in the logs directory. Creating a new log file when the current one
+ is rolled then only needs to rename the standby file into place, rather than doing all of that work on the logger's
+ queue while log messages wait.
+ Note that the header of a standby file is written when the file is prepared, so a `logFileHeader` which changes over time
+ will see the standby file discarded and a log file created the usual way.
+ */
+@property (atomic, assign) BOOL usesStandbyLogFile;
+
+/**
+ Archived log files last written to longer ago than this are deleted, in addition to those deleted due to the
+ `maximumNumberOfLogFiles` and `logFilesDiskQuota` limits. Defaults to zero, which disables age based deletion.
+ As with the other limits, old log files are deleted whenever a new log file is created. As a quiet log may not create
+ one for a long time, files past this age are also deleted shortly after it is first set, and then hourly.
+ */
+@property (atomic, assign) NSTimeInterval maximumFileAge;
+
+/**
+ The file extension of the log files (without the leading "."). Defaults to "log".
+ Log files with any other extension in the logs directory are ignored, so a logger writing in another format
+ (i.e. `SproutCompressedFileLogger`) should use a different extension. Should be set before the manager is given to a logger.
+ */
+@property (nonatomic, copy) NSString *logFileExtension;
+
+@end
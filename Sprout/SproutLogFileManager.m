@@ -0,0 +1,728 @@
+//
+//  SproutLogFileManager.m
+//
+//  Part of "Sprout" https://github.com/levigroker/Sprout
+//
+//  Created on October 19, 2026.
+//  Copyright (c) 2026 Levi Brown <mailto:levigroker@gmail.com> This work is
+//  licensed under the Creative Commons Attribution 4.0 International License. To
+//  view a copy of this license, visit https://creativecommons.org/licenses/by/4.0/
+//  or send a letter to Creative Commons, PO Box 1866, Mountain View, CA 94042, USA.
+//
+//  The above attribution and the included license must accompany any version of
+//  the source code, binary distributable, or derivatives.
+//
+
+#include <errno.h>
+#include <fcntl.h>
+#include <stdio.h>
+#include <unistd.h>
+
+#import <os/lock.h>
+
+#import "SproutLogFileManager.h"
+
+static NSUInteger const kSproutMaximumFileCreationErrors = 5;
+static NSString * const kSproutDefaultLogFileExtension = @"log";
+static NSString * const kSproutStandbyLogFileExtension = @"standby";
+static NSString * const kSproutPreparingLogFileExtension = @"preparing";
+//How soon after the manager is created, and then how often, log files past `maximumFileAge` are deleted
+static int64_t const kSproutFileAgePurgeDelay = 30 * NSEC_PER_SEC;
+static int64_t const kSproutFileAgePurgeInterval = 60 * 60 * NSEC_PER_SEC;
+
+//Private `DDLogFileManagerDefault` methods used by this subclass
+@interface DDLogFileManagerDefault (SproutLogFileManager)
+
+- (NSString *)applicationName;
+- (NSDateFormatter *)logFileDateFormatter;
+- (NSData *)logFileHeaderData;
+- (void)deleteOldLogFiles;
+#if TARGET_OS_IPHONE
+- (NSFileProtectionType)logFileProtection;
+#endif
+
+@end
+
+@interface SproutLogFileManager ()
+{
+    //Counts the manager's own changes to the logs directory (see `performDirectoryChange:`)
+    uint64_t _directoryChangeCount;
+    //Guards the model properties. Never held while the directory is listed or files are inspected.
+    os_unfair_lock _modelLock;
+}
+
+//Loading and reconciling the model (which list the directory) happen on this queue
+@property (nonatomic, strong) dispatch_queue_t modelQueue;
+//Set once the model has first been loaded
+@property (atomic, assign) BOOL modelLoaded;
+@property (atomic, copy) NSString *modelDirectory;
+//Newest first
+@property (nonatomic, strong) NSArray<DDLogFileInfo *> *modelLogFileInfos;
+@property (nonatomic, strong) NSMutableDictionary<NSString *, NSDate *> *modelDates;
+//Paths of the log files which have not been archived, and so may still be written to
+@property (nonatomic, strong) NSMutableSet<NSString *> *liveLogFilePaths;
+@property (nonatomic, strong) dispatch_source_t directorySource;
+//The `_directoryChangeCount` when the directory monitor last handled an event
+@property (nonatomic, assign) uint64_t handledDirectoryChangeCount;
+//Standby log file preparation happens on this queue
+@property (nonatomic, strong) dispatch_queue_t standbyQueue;
+//The header the standby log file was prepared with
+@property (atomic, strong) NSData *standbyHeaderData;
+//Deletes log files past `maximumFileAge` even when no new log file is created
+@property (nonatomic, strong) dispatch_source_t fileAgePurgeTimer;
+
+@end
+
+@implementation SproutLogFileManager
+
+@synthesize maximumFileAge = _maximumFileAge;
+
+#pragma mark - Lifecycle
+
+- (instancetype)initWithLogsDirectory:(NSString *)logsDirectory
+{
+    if ((self = [super initWithLogsDirectory:logsDirectory]))
+    {
+        _modelQueue = dispatch_queue_create("sprout.logfilemanager", DISPATCH_QUEUE_SERIAL);
+        _modelLock = OS_UNFAIR_LOCK_INIT;
+        _modelDirectory = [[self logsDirectory] copy];
+        _modelLogFileInfos = @[];
+        _modelDates = [NSMutableDictionary dictionary];
+        _liveLogFilePaths = [NSMutableSet set];
+        _standbyQueue = dispatch_queue_create("sprout.logfilemanager.standby", dispatch_queue_attr_make_with_qos_class(DISPATCH_QUEUE_SERIAL, QOS_CLASS_UTILITY, 0));
+        _usesStandbyLogFile = YES;
+        _logFileExtension = kSproutDefaultLogFileExtension;
+
+        //Load the model in the background. The first caller needing it simply waits for this to finish.
+        dispatch_async(_modelQueue, ^{ @autoreleasepool {
+            [self loadModel];
+            self.modelLoaded = YES;
+            [self startMonitoringDirectory];
+        } });
+
+        //Any standby log file left from a previous run may have been prepared differently, so it is replaced.
+        [self prepareStandbyLogFile];
+    }
+
+    return self;
+}
+
+- (void)dealloc
+{
+    if (_directorySource)
+    {
+        dispatch_source_cancel(_directorySource);
+    }
+    if (_fileAgePurgeTimer)
+    {
+        dispatch_source_cancel(_fileAgePurgeTimer);
+    }
+}
+
+#pragma mark - Log Files
+
+- (NSArray<DDLogFileInfo *> *)sortedLogFileInfos
+{
+    //`DDLogFileManagerDefault` may ask for its log files before our initialization has finished.
+    if (!self.modelQueue)
+    {
+        return [super sortedLogFileInfos];
+    }
+
+    [self waitForModel];
+
+    os_unfair_lock_lock(&_modelLock);
+    NSArray<DDLogFileInfo *> *logFileInfos = self.modelLogFileInfos;
+    NSSet<NSString *> *liveLogFilePaths = self.liveLogFilePaths.count > 0 ? [self.liveLogFilePaths copy] : nil;
+    os_unfair_lock_unlock(&_modelLock);
+
+    if (!liveLogFilePaths)
+    {
+        return logFileInfos;
+    }
+
+    NSMutableArray<DDLogFileInfo *> *retVal = [logFileInfos mutableCopy];
+    [logFileInfos enumerateObjectsUsingBlock:^(DDLogFileInfo *logFileInfo, NSUInteger idx, BOOL *stop) {
+        if ([liveLogFilePaths containsObject:logFileInfo.filePath])
+        {
+            retVal[idx] = [[DDLogFileInfo alloc] initWithFilePath:logFileInfo.filePath];
+        }
+    }];
+
+    return retVal;
+}
+
+- (NSArray<DDLogFileInfo *> *)unsortedLogFileInfos
+{
+    return [self sortedLogFileInfos];
+}
+
+- (NSArray<NSString *> *)unsortedLogFilePaths
+{
+    if (!self.modelQueue)
+    {
+        return [super unsortedLogFilePaths];
+    }
+
+    [self waitForModel];
+
+    os_unfair_lock_lock(&_modelLock);
+    NSArray<DDLogFileInfo *> *logFileInfos = self.modelLogFileInfos;
+    os_unfair_lock_unlock(&_modelLock);
+
+    return [logFileInfos valueForKey:NSStringFromSelector(@selector(filePath))];
+}
+
+#pragma mark - Creation
+
+- (void)setLogFileExtension:(NSString *)logFileExtension
+{
+    _logFileExtension = [logFileExtension copy];
+
+    //The model only holds files with the extension
+    if (self.modelQueue)
+    {
+        dispatch_async(self.modelQueue, ^{ @autoreleasepool {
+            [self loadModel];
+        } });
+    }
+}
+
+- (NSString *)newLogFileName
+{
+    return [[[super newLogFileName] stringByDeletingPathExtension] stringByAppendingPathExtension:self.logFileExtension];
+}
+
+- (BOOL)isLogFile:(NSString *)fileName
+{
+    NSString *prefix = [[self applicationName] stringByAppendingString:@" "];
+    NSString *suffix = [@"." stringByAppendingString:self.logFileExtension ?: kSproutDefaultLogFileExtension];
+
+    return [fileName hasPrefix:prefix] && [fileName hasSuffix:suffix];
+}
+
+- (NSString *)createNewLogFileWithError:(NSError *__autoreleasing *)error
+{
+    NSString *fileName = [self newLogFileName];
+    NSData *fileHeader = [self logFileHeaderData] ?: [NSData data];
+
+    NSUInteger attempt = 1;
+    NSUInteger criticalErrors = 0;
+    NSError *lastCriticalError = nil;
+
+    while (criticalErrors < kSproutMaximumFileCreationErrors)
+    {
+        NSString *actualFileName = fileName;
+        if (attempt > 1)
+        {
+            actualFileName = [[[fileName stringByDeletingPathExtension] stringByAppendingFormat:@" %lu", (unsigned long)attempt] stringByAppendingPathExtension:fileName.pathExtension];
+        }
+
+        NSString *filePath = [self.modelDirectory stringByAppendingPathComponent:actualFileName];
+
+        NSError *currentError = nil;
+        BOOL success = [fileHeader isEqualToData:self.standbyHeaderData] && [self moveStandbyLogFileToPath:filePath error:&currentError];
+        if (!success && !currentError)
+        {
+            success = [self createLogFileAtPath:filePath header:fileHeader error:&currentError];
+        }
+
+        if (success)
+        {
+            //Record the new file before anything (i.e. `deleteOldLogFiles`) can ask for it. This only takes the model
+            //lock, so it never waits for a directory listing on `modelQueue`.
+            [self addLogFilePath:filePath isArchived:NO];
+
+            dispatch_async(dispatch_get_global_queue(DISPATCH_QUEUE_PRIORITY_DEFAULT, 0), ^{ @autoreleasepool {
+                //Since we just created a new log file, we may need to delete some old log files
+                [self deleteOldLogFiles];
+            } });
+
+            [self prepareStandbyLogFile];
+
+            return filePath;
+        }
+        else if (currentError.code == NSFileWriteFileExistsError)
+        {
+            ++attempt;
+        }
+        else
+        {
+            ++criticalErrors;
+            lastCriticalError = currentError;
+        }
+    }
+
+    if (error)
+    {
+        *error = lastCriticalError;
+    }
+
+    return nil;
+}
+
+- (BOOL)createLogFileAtPath:(NSString *)filePath header:(NSData *)header error:(NSError *__autoreleasing *)error
+{
+    __block BOOL retVal = NO;
+    [self performDirectoryChange:^{
+        retVal = [header writeToFile:filePath options:NSDataWritingWithoutOverwriting error:error];
+    }];
+
+#if TARGET_OS_IPHONE
+    if (retVal)
+    {
+        //See `-[DDLogFileManagerDefault createNewLogFileWithError:]` for why the protection level is set explicitly.
+        retVal = [[NSFileManager defaultManager] setAttributes:@{ NSFileProtectionKey: [self logFileProtection] } ofItemAtPath:filePath error:error];
+    }
+#endif
+
+    return retVal;
+}
+
+#pragma mark - Standby Log File
+
+- (NSString *)standbyFilePath
+{
+    NSString *fileName = [NSString stringWithFormat:@".%@.%@", [self applicationName], kSproutStandbyLogFileExtension];
+    return [self.modelDirectory stringByAppendingPathComponent:fileName];
+}
+
+- (void)prepareStandbyLogFile
+{
+    if (!self.usesStandbyLogFile)
+    {
+        return;
+    }
+
+    dispatch_async(self.standbyQueue, ^{ @autoreleasepool {
+        NSFileManager *fileManager = [NSFileManager defaultManager];
+        NSData *header = [self logFileHeaderData] ?: [NSData data];
+        NSString *standbyFilePath = [self standbyFilePath];
+
+        if ([fileManager fileExistsAtPath:standbyFilePath])
+        {
+            if ([header isEqualToData:self.standbyHeaderData])
+            {
+                return;
+            }
+            [self performDirectoryChange:^{
+                [fileManager removeItemAtPath:standbyFilePath error:nil];
+            }];
+        }
+
+        //Prepare the file under another name, so the standby file is only ever seen complete.
+        NSString *preparingFilePath = [[standbyFilePath stringByDeletingPathExtension] stringByAppendingPathExtension:kSproutPreparingLogFileExtension];
+        if ([fileManager fileExistsAtPath:preparingFilePath])
+        {
+            [self performDirectoryChange:^{
+                [fileManager removeItemAtPath:preparingFilePath error:nil];
+            }];
+        }
+        if ([self createLogFileAtPath:preparingFilePath header:header error:nil])
+        {
+            self.standbyHeaderData = header;
+            [self performDirectoryChange:^{
+                if (rename(preparingFilePath.fileSystemRepresentation, standbyFilePath.fileSystemRepresentation) != 0)
+                {
+                    [fileManager removeItemAtPath:preparingFilePath error:nil];
+                }
+            }];
+        }
+    } });
+}
+
+/**
+ Moves the standby log file (if there is one) to the given path.
+
+ @return `YES` if the standby log file is now at the given path. If `NO` and `error` is set, a file already exists at the given path.
+ */
+- (BOOL)moveStandbyLogFileToPath:(NSString *)filePath error:(NSError *__autoreleasing *)error
+{
+    if (!self.usesStandbyLogFile)
+    {
+        return NO;
+    }
+
+    __block int result = 0;
+    __block int renameError = 0;
+    [self performDirectoryChange:^{
+        result = renamex_np([self standbyFilePath].fileSystemRepresentation, filePath.fileSystemRepresentation, RENAME_EXCL);
+        renameError = errno;
+    }];
+
+    if (result != 0)
+    {
+        if (renameError == EEXIST && error)
+        {
+            *error = [NSError errorWithDomain:NSCocoaErrorDomain code:NSFileWriteFileExistsError userInfo:@{ NSFilePathErrorKey: filePath }];
+        }
+        return NO;
+    }
+
+    //`DDFileLogger` rolls log files based on their creation date, so the file must appear to have been created just now.
+    NSDate *now = [NSDate date];
+    [[NSFileManager defaultManager] setAttributes:@{ NSFileCreationDate: now, NSFileModificationDate: now } ofItemAtPath:filePath error:nil];
+
+    return YES;
+}
+
+#pragma mark - Archiving
+
+- (void)didArchiveLogFile:(NSString *)logFilePath wasRolled:(BOOL)wasRolled
+{
+    dispatch_async(self.modelQueue, ^{ @autoreleasepool {
+        if (![self archiveLogFilePath:logFilePath])
+        {
+            //Archiving renamed the file (as happens in the simulator)
+            [self reconcileModel];
+        }
+    } });
+}
+
+#pragma mark - Deleting
+
+- (void)deleteOldLogFiles
+{
+    //The same policy as `DDLogFileManagerDefault` (plus `maximumFileAge`), but working from the model.
+    NSArray<DDLogFileInfo *> *sortedLogFileInfos = [self sortedLogFileInfos];
+    NSUInteger firstIndexToDelete = NSNotFound;
+
+    const unsigned long long diskQuota = self.logFilesDiskQuota;
+    const NSUInteger maxNumLogFiles = self.maximumNumberOfLogFiles;
+
+    if (diskQuota)
+    {
+        unsigned long long used = 0;
+        for (NSUInteger i = 0; i < sortedLogFileInfos.count; ++i)
+        {
+            used += sortedLogFileInfos[i].fileSize;
+            if (used > diskQuota)
+            {
+                firstIndexToDelete = i;
+                break;
+            }
+        }
+    }
+
+    if (maxNumLogFiles)
+    {
+        firstIndexToDelete = MIN(firstIndexToDelete, maxNumLogFiles);
+    }
+
+    const NSTimeInterval maximumFileAge = self.maximumFileAge;
+    if (maximumFileAge > 0)
+    {
+        NSDate *oldestModificationDate = [NSDate dateWithTimeIntervalSinceNow:-maximumFileAge];
+        for (NSUInteger i = 0; i < MIN(firstIndexToDelete, sortedLogFileInfos.count); ++i)
+        {
+            DDLogFileInfo *logFileInfo = sortedLogFileInfos[i];
+            if ([logFileInfo.modificationDate compare:oldestModificationDate] == NSOrderedAscending && logFileInfo.isArchived)
+            {
+                firstIndexToDelete = i;
+                break;
+            }
+        }
+    }
+
+    //Never delete the file currently being written to
+    if (firstIndexToDelete == 0 && sortedLogFileInfos.count > 0 && !sortedLogFileInfos[0].isArchived)
+    {
+        ++firstIndexToDelete;
+    }
+
+    if (firstIndexToDelete >= sortedLogFileInfos.count)
+    {
+        return;
+    }
+
+    NSMutableArray<NSString *> *deletedFilePaths = [NSMutableArray array];
+    for (NSUInteger i = firstIndexToDelete; i < sortedLogFileInfos.count; ++i)
+    {
+        NSString *filePath = sortedLogFileInfos[i].filePath;
+        [self performDirectoryChange:^{
+            if ([[NSFileManager defaultManager] removeItemAtPath:filePath error:nil])
+            {
+                [deletedFilePaths addObject:filePath];
+            }
+        }];
+    }
+
+    [self removeLogFilePaths:deletedFilePaths];
+}
+
+- (NSTimeInterval)maximumFileAge
+{
+    @synchronized (self)
+    {
+        return _maximumFileAge;
+    }
+}
+
+- (void)setMaximumFileAge:(NSTimeInterval)maximumFileAge
+{
+    @synchronized (self)
+    {
+        _maximumFileAge = maximumFileAge;
+
+        //Managers which never delete files by age (most of them) have no timer
+        if (maximumFileAge > 0 && !self.fileAgePurgeTimer)
+        {
+            [self startFileAgePurgeTimer];
+        }
+    }
+}
+
+/**
+ Log files are otherwise only deleted when a new log file is created, which may be a long time coming for a quiet log
+ (i.e. the high severity tier of `tieredFileLogging`). So once `maximumFileAge` is set, files past it are also deleted
+ shortly afterwards, and then hourly.
+ */
+- (void)startFileAgePurgeTimer
+{
+    dispatch_source_t timer = dispatch_source_create(DISPATCH_SOURCE_TYPE_TIMER, 0, 0, dispatch_get_global_queue(QOS_CLASS_UTILITY, 0));
+    dispatch_source_set_timer(timer, dispatch_time(DISPATCH_TIME_NOW, kSproutFileAgePurgeDelay), (uint64_t)kSproutFileAgePurgeInterval, (uint64_t)kSproutFileAgePurgeInterval / 10);
+
+    __weak typeof(self) weakSelf = self;
+    dispatch_source_set_event_handler(timer, ^{ @autoreleasepool {
+        SproutLogFileManager *strongSelf = weakSelf;
+        if (strongSelf.maximumFileAge > 0)
+        {
+            [strongSelf deleteOldLogFiles];
+        }
+    } });
+
+    self.fileAgePurgeTimer = timer;
+    dispatch_resume(timer);
+}
+
+#pragma mark - Model
+
+//Waits for the initial load of the model, which only ever makes the first callers wait
+- (void)waitForModel
+{
+    if (!self.modelLoaded)
+    {
+        dispatch_sync(self.modelQueue, ^{});
+    }
+}
+
+//The following two methods must only be called on `modelQueue`
+
+- (void)loadModel
+{
+    NSArray<NSString *> *filePaths = [super unsortedLogFilePaths];
+
+    os_unfair_lock_lock(&_modelLock);
+    self.modelLogFileInfos = @[];
+    [self.modelDates removeAllObjects];
+    [self.liveLogFilePaths removeAllObjects];
+    os_unfair_lock_unlock(&_modelLock);
+
+    for (NSString *filePath in filePaths)
+    {
+        DDLogFileInfo *logFileInfo = [[DDLogFileInfo alloc] initWithFilePath:filePath];
+        [self addLogFilePath:filePath isArchived:logFileInfo.isArchived];
+    }
+}
+
+//Brings the model in line with the contents of the logs directory, based on file names alone.
+- (void)reconcileModel
+{
+    NSArray<NSString *> *filePaths = [super unsortedLogFilePaths];
+
+    os_unfair_lock_lock(&_modelLock);
+    NSArray<NSString *> *modelFilePaths = self.modelDates.allKeys;
+    os_unfair_lock_unlock(&_modelLock);
+
+    NSMutableArray<NSString *> *removedFilePaths = [NSMutableArray array];
+    NSSet<NSString *> *filePathSet = [NSSet setWithArray:filePaths];
+    for (NSString *filePath in modelFilePaths)
+    {
+        if (![filePathSet containsObject:filePath])
+        {
+            [removedFilePaths addObject:filePath];
+        }
+    }
+    [self removeLogFilePaths:removedFilePaths];
+
+    NSSet<NSString *> *modelFilePathSet = [NSSet setWithArray:modelFilePaths];
+    for (NSString *filePath in filePaths)
+    {
+        if (![modelFilePathSet containsObject:filePath])
+        {
+            DDLogFileInfo *logFileInfo = [[DDLogFileInfo alloc] initWithFilePath:filePath];
+            [self addLogFilePath:filePath isArchived:logFileInfo.isArchived];
+        }
+    }
+}
+
+//The following methods may be called from any thread
+
+- (void)addLogFilePath:(NSString *)filePath isArchived:(BOOL)isArchived
+{
+    //Inspect the file before taking the lock
+    DDLogFileInfo *logFileInfo = [[DDLogFileInfo alloc] initWithFilePath:filePath];
+    if (isArchived)
+    {
+        //Fetch (and cache) the attributes now, since this instance is shared between threads from here on.
+        (void)logFileInfo.fileAttributes;
+    }
+    NSDate *date = [self dateForLogFileInfo:logFileInfo];
+
+    os_unfair_lock_lock(&_modelLock);
+
+    //It may already have been picked up by the directory monitor
+    if (!self.modelDates[filePath])
+    {
+        if (!isArchived)
+        {
+            [self.liveLogFilePaths addObject:filePath];
+        }
+        self.modelDates[filePath] = date;
+
+        //New log files are almost always the newest, so search from the front.
+        NSUInteger index = 0;
+        NSArray<DDLogFileInfo *> *logFileInfos = self.modelLogFileInfos;
+        while (index < logFileInfos.count && [self.modelDates[logFileInfos[index].filePath] compare:date] == NSOrderedDescending)
+        {
+            ++index;
+        }
+
+        NSMutableArray<DDLogFileInfo *> *updatedLogFileInfos = [logFileInfos mutableCopy];
+        [updatedLogFileInfos insertObject:logFileInfo atIndex:index];
+        self.modelLogFileInfos = [updatedLogFileInfos copy];
+    }
+
+    os_unfair_lock_unlock(&_modelLock);
+}
+
+/**
+ Replaces the model's `DDLogFileInfo` for the given log file with one for the archived file.
+ @return `NO` if the model doesn't have the file.
+ */
+- (BOOL)archiveLogFilePath:(NSString *)filePath
+{
+    DDLogFileInfo *logFileInfo = [[DDLogFileInfo alloc] initWithFilePath:filePath];
+    (void)logFileInfo.fileAttributes;
+
+    os_unfair_lock_lock(&_modelLock);
+
+    NSUInteger index = [self.modelLogFileInfos indexOfObjectPassingTest:^BOOL(DDLogFileInfo *modelLogFileInfo, NSUInteger idx, BOOL *stop) {
+        return [modelLogFileInfo.filePath isEqualToString:filePath];
+    }];
+    if (index != NSNotFound)
+    {
+        NSMutableArray<DDLogFileInfo *> *updatedLogFileInfos = [self.modelLogFileInfos mutableCopy];
+        updatedLogFileInfos[index] = logFileInfo;
+        self.modelLogFileInfos = [updatedLogFileInfos copy];
+        [self.liveLogFilePaths removeObject:filePath];
+    }
+
+    os_unfair_lock_unlock(&_modelLock);
+
+    return index != NSNotFound;
+}
+
+- (void)removeLogFilePaths:(NSArray<NSString *> *)filePaths
+{
+    if (filePaths.count == 0)
+    {
+        return;
+    }
+
+    NSSet<NSString *> *filePathSet = [NSSet setWithArray:filePaths];
+
+    os_unfair_lock_lock(&_modelLock);
+
+    NSIndexSet *indexes = [self.modelLogFileInfos indexesOfObjectsPassingTest:^BOOL(DDLogFileInfo *logFileInfo, NSUInteger idx, BOOL *stop) {
+        return [filePathSet containsObject:logFileInfo.filePath];
+    }];
+
+    NSMutableArray<DDLogFileInfo *> *updatedLogFileInfos = [self.modelLogFileInfos mutableCopy];
+    [updatedLogFileInfos removeObjectsAtIndexes:indexes];
+    self.modelLogFileInfos = [updatedLogFileInfos copy];
+
+    [self.modelDates removeObjectsForKeys:filePaths];
+    [self.liveLogFilePaths minusSet:filePathSet];
+
+    os_unfair_lock_unlock(&_modelLock);
+}
+
+//The date `DDLogFileManagerDefault` sorts by: the date in the file name, falling back to the creation date.
+- (NSDate *)dateForLogFileInfo:(DDLogFileInfo *)logFileInfo
+{
+    NSString *dateString = [logFileInfo.fileName componentsSeparatedByString:@" "].lastObject;
+    dateString = [dateString stringByReplacingOccurrencesOfString:[@"." stringByAppendingString:self.logFileExtension] withString:@""];
+#if TARGET_OS_SIMULATOR
+    dateString = [dateString stringByReplacingOccurrencesOfString:@".archived" withString:@""];
+#endif
+
+    NSDate *retVal = [[self logFileDateFormatter] dateFromString:dateString] ?: logFileInfo.creationDate;
+    return retVal ?: [NSDate distantPast];
+}
+
+#pragma mark - Directory Monitoring
+
+/**
+ Makes a change to the logs directory. The model already accounts for the manager's own changes, so the directory monitor
+ doesn't need to list the directory for the events they cause. The count is bumped before and after the change, so an
+ event delivered while the change is under way is recognized as well.
+ */
+- (void)performDirectoryChange:(void (NS_NOESCAPE ^)(void))change
+{
+    __atomic_add_fetch(&_directoryChangeCount, 1, __ATOMIC_RELEASE);
+    change();
+    __atomic_add_fetch(&_directoryChangeCount, 1, __ATOMIC_RELEASE);
+}
+
+- (void)startMonitoringDirectory
+{
+    int fileDescriptor = open(self.modelDirectory.fileSystemRepresentation, O_EVTONLY);
+    if (fileDescriptor < 0)
+    {
+        return;
+    }
+
+    dispatch_source_t source = dispatch_source_create(DISPATCH_SOURCE_TYPE_VNODE, (uintptr_t)fileDescriptor, DISPATCH_VNODE_WRITE | DISPATCH_VNODE_DELETE | DISPATCH_VNODE_RENAME | DISPATCH_VNODE_REVOKE, self.modelQueue);
+
+    __weak typeof(self) weakSelf = self;
+    dispatch_source_set_event_handler(source, ^{ @autoreleasepool {
+        SproutLogFileManager *strongSelf = weakSelf;
+        if (!strongSelf)
+        {
+            return;
+        }
+
+        unsigned long events = dispatch_source_get_data(strongSelf.directorySource);
+        if (events & (DISPATCH_VNODE_DELETE | DISPATCH_VNODE_RENAME | DISPATCH_VNODE_REVOKE))
+        {
+            //The directory itself went away. `logsDirectory` re-creates it.
+            dispatch_source_cancel(strongSelf.directorySource);
+            strongSelf.directorySource = nil;
+            strongSelf.modelDirectory = [strongSelf logsDirectory];
+            [strongSelf loadModel];
+            [strongSelf startMonitoringDirectory];
+            [strongSelf prepareStandbyLogFile];
+        }
+        else
+        {
+            //Only list the directory for changes made by something else. (An outside change whose event is merged with
+            //one of the manager's own is picked up by the next outside change, or when the model is next loaded.)
+            uint64_t changeCount = __atomic_load_n(&strongSelf->_directoryChangeCount, __ATOMIC_ACQUIRE);
+            if (changeCount == strongSelf.handledDirectoryChangeCount)
+            {
+                [strongSelf reconcileModel];
+            }
+            strongSelf.handledDirectoryChangeCount = changeCount;
+        }
+    } });
+
+    dispatch_source_set_cancel_handler(source, ^{
+        close(fileDescriptor);
+    });
+
+    self.directorySource = source;
+    dispatch_resume(source);
+}
+
+@end
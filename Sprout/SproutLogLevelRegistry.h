@@ -0,0 +1,94 @@
+//
+//  SproutLogLevelRegistry.h
+//
+//  Part of "Sprout" https://github.com/levigroker/Sprout
+//
+//  Created on October 19, 2026.
+//  Copyright (c) 2026 Levi Brown <mailto:levigroker@gmail.com> This work is
+//  licensed under the Creative Commons Attribution 4.0 International License. To
+//  view a copy of this license, visit https://creativecommons.org/licenses/by/4.0/
+//  or send a letter to Creative Commons, PO Box 1866, Mountain View, CA 94042, USA.
+//
+//  The above attribution and the included license must accompany any version of
+//  the source code, binary distributable, or derivatives.
+//
+
+#import <Foundation/Foundation.h>
+#import <CocoaLumberjack/CocoaLumberjack.h>
+
+NS_ASSUME_NONNULL_BEGIN
+
+/**
+ Adds a class name to the registry. Called before `main` by `SPROUT_DYNAMIC_LOG_LEVEL`, so only stores the name.
+ */
+void SproutLogLevelRegistryAddClassName(const char *className);
+
+/**
+ Implements `DDRegisteredDynamicLogging` for the class, with its level stored as the module level of the class name
+ (see SproutLogLevels.h), which applies to the statements in the class's source file (when the file is named after the
+ class). The class joins the registry before `main`, without a class list scan. Subclasses inherit the methods, and with
+ them the class's level (their own source files are not covered unless they use the macro too). Use it in the class's
+ `@implementation`:
+
+     @implementation MyViewController
+
+     SPROUT_DYNAMIC_LOG_LEVEL(MyViewController)
+     ...
+ */
+#define SPROUT_DYNAMIC_LOG_LEVEL(className)                                                 \
+        __attribute__((constructor)) static void sproutRegisterDynamicLogLevel##className(void) \
+        {                                                                                   \
+            SproutLogLevelRegistryAddClassName(#className);                                 \
+        }                                                                                   \
+        + (DDLogLevel)ddLogLevel                                                            \
+        {                                                                                   \
+            return [SproutLogLevelRegistry logLevelForClassWithName:@#className];           \
+        }                                                                                   \
+        + (void)ddSetLogLevel:(DDLogLevel)logLevel                                          \
+        {                                                                                   \
+            [SproutLogLevelRegistry setLogLevel:logLevel forClassWithName:@#className];     \
+        }
+
+/**
+ A registry of the classes whose log levels can be managed by name, i.e. from a settings screen or a debugging tool.
+ Unlike `+[DDLog registeredClasses]`, which scans every class in the process each time it is called, classes join the
+ registry (with `SPROUT_DYNAMIC_LOG_LEVEL` or `registerClass:`), and are looked up by name in constant time.
+ */
+@interface SproutLogLevelRegistry : NSObject
+
+/**
+ Adds a class which implements `DDRegisteredDynamicLogging` itself. Its level is managed with its own `ddLogLevel` and
+ `ddSetLogLevel:` methods.
+ */
++ (void)registerClass:(Class)aClass;
+
+/**
+ @return The names of the registered classes, sorted.
+ */
++ (NSArray<NSString *> *)registeredClassNames;
+
+/**
+ @return The registered classes.
+ */
++ (NSArray<Class> *)registeredClasses;
+
+/**
+ @return The registered class with the given name, or `nil` if there is none.
+ */
++ (nullable Class)registeredClassWithName:(NSString *)className;
+
++ (DDLogLevel)logLevelForClass:(Class)aClass;
++ (void)setLogLevel:(DDLogLevel)logLevel forClass:(Class)aClass;
+
++ (DDLogLevel)logLevelForClassWithName:(NSString *)className;
++ (void)setLogLevel:(DDLogLevel)logLevel forClassWithName:(NSString *)className;
+
+/**
+ Sets the log level of every registered class. The classes registered with `SPROUT_DYNAMIC_LOG_LEVEL` are set together,
+ with a single update of the log level table.
+ */
++ (void)setLogLevelForAllClasses:(DDLogLevel)logLevel;
+
+@end
+
+NS_ASSUME_NONNULL_END
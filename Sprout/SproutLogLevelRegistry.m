@@ -0,0 +1,232 @@
+//
+//  SproutLogLevelRegistry.m
+//
+//  Part of "Sprout" https://github.com/levigroker/Sprout
+//
+//  Created on October 19, 2026.
+//  Copyright (c) 2026 Levi Brown <mailto:levigroker@gmail.com> This work is
+//  licensed under the Creative Commons Attribution 4.0 International License. To
+//  view a copy of this license, visit https://creativecommons.org/licenses/by/4.0/
+//  or send a letter to Creative Commons, PO Box 1866, Mountain View, CA 94042, USA.
+//
+//  The above attribution and the included license must accompany any version of
+//  the source code, binary distributable, or derivatives.
+//
+
+#include <os/lock.h>
+#include <stdlib.h>
+
+#import "SproutLogLevelRegistry.h"
+#import "SproutLogLevels.h"
+
+//Names added before `main`, not yet in the registry
+static const char **sproutPendingClassNames = NULL;
+static size_t sproutPendingClassNameCount = 0;
+static size_t sproutPendingClassNameCapacity = 0;
+
+//Class name to class (or `NSNull`, until the class is first looked up)
+static NSMutableDictionary<NSString *, id> *sproutRegisteredClasses = nil;
+//The names of the classes which implement `DDRegisteredDynamicLogging` themselves
+static NSMutableSet<NSString *> *sproutSelfManagedClassNames = nil;
+static os_unfair_lock sproutRegistryLock = OS_UNFAIR_LOCK_INIT;
+
+void SproutLogLevelRegistryAddClassName(const char *className)
+{
+    os_unfair_lock_lock(&sproutRegistryLock);
+    if (sproutPendingClassNameCount == sproutPendingClassNameCapacity)
+    {
+        size_t capacity = sproutPendingClassNameCapacity ? sproutPendingClassNameCapacity * 2 : 64;
+        const char **names = realloc(sproutPendingClassNames, capacity * sizeof(const char *));
+        if (!names)
+        {
+            os_unfair_lock_unlock(&sproutRegistryLock);
+            return;
+        }
+        sproutPendingClassNames = names;
+        sproutPendingClassNameCapacity = capacity;
+    }
+    sproutPendingClassNames[sproutPendingClassNameCount++] = className;
+    os_unfair_lock_unlock(&sproutRegistryLock);
+}
+
+//Must be called with the lock held
+static void sproutAddPendingClassNames(void)
+{
+    if (!sproutRegisteredClasses)
+    {
+        sproutRegisteredClasses = [[NSMutableDictionary alloc] init];
+        sproutSelfManagedClassNames = [[NSMutableSet alloc] init];
+    }
+
+    for (size_t i = 0; i < sproutPendingClassNameCount; ++i)
+    {
+        NSString *className = @(sproutPendingClassNames[i]);
+        if (!sproutRegisteredClasses[className])
+        {
+            sproutRegisteredClasses[className] = [NSNull null];
+        }
+    }
+    sproutPendingClassNameCount = 0;
+}
+
+//Must be called with the lock held
+static Class sproutRegisteredClass(NSString *className)
+{
+    id retVal = sproutRegisteredClasses[className];
+    if (retVal == [NSNull null])
+    {
+        retVal = NSClassFromString(className);
+        if (retVal)
+        {
+            sproutRegisteredClasses[className] = retVal;
+        }
+    }
+
+    return retVal;
+}
+
+@implementation SproutLogLevelRegistry
+
++ (void)registerClass:(Class)aClass
+{
+    if (![aClass conformsToProtocol:@protocol(DDRegisteredDynamicLogging)])
+    {
+        return;
+    }
+
+    NSString *className = NSStringFromClass(aClass);
+
+    os_unfair_lock_lock(&sproutRegistryLock);
+    sproutAddPendingClassNames();
+    sproutRegisteredClasses[className] = aClass;
+    [sproutSelfManagedClassNames addObject:className];
+    os_unfair_lock_unlock(&sproutRegistryLock);
+}
+
++ (NSArray<NSString *> *)registeredClassNames
+{
+    os_unfair_lock_lock(&sproutRegistryLock);
+    sproutAddPendingClassNames();
+    NSArray<NSString *> *retVal = sproutRegisteredClasses.allKeys;
+    os_unfair_lock_unlock(&sproutRegistryLock);
+
+    return [retVal sortedArrayUsingSelector:@selector(compare:)];
+}
+
++ (NSArray<Class> *)registeredClasses
+{
+    NSMutableArray<Class> *retVal = [NSMutableArray array];
+
+    os_unfair_lock_lock(&sproutRegistryLock);
+    sproutAddPendingClassNames();
+    for (NSString *className in sproutRegisteredClasses.allKeys)
+    {
+        Class aClass = sproutRegisteredClass(className);
+        if (aClass)
+        {
+            [retVal addObject:aClass];
+        }
+    }
+    os_unfair_lock_unlock(&sproutRegistryLock);
+
+    return retVal;
+}
+
++ (Class)registeredClassWithName:(NSString *)className
+{
+    if (!className)
+    {
+        return nil;
+    }
+
+    os_unfair_lock_lock(&sproutRegistryLock);
+    sproutAddPendingClassNames();
+    Class retVal = sproutRegisteredClass(className);
+    os_unfair_lock_unlock(&sproutRegistryLock);
+
+    return retVal;
+}
+
++ (DDLogLevel)logLevelForClass:(Class)aClass
+{
+    return [self logLevelForClassWithName:NSStringFromClass(aClass)];
+}
+
++ (void)setLogLevel:(DDLogLevel)logLevel forClass:(Class)aClass
+{
+    [self setLogLevel:logLevel forClassWithName:NSStringFromClass(aClass)];
+}
+
++ (DDLogLevel)logLevelForClassWithName:(NSString *)className
+{
+    if ([self isSelfManagedClassWithName:className])
+    {
+        return [(id<DDRegisteredDynamicLogging>)[self registeredClassWithName:className] ddLogLevel];
+    }
+
+    uint32_t retVal = SproutLogLevelGetForModule(className.UTF8String);
+    return retVal == UINT32_MAX ? DDLogLevelAll : (DDLogLevel)retVal;
+}
+
++ (void)setLogLevel:(DDLogLevel)logLevel forClassWithName:(NSString *)className
+{
+    if ([self isSelfManagedClassWithName:className])
+    {
+        [(id<DDRegisteredDynamicLogging>)[self registeredClassWithName:className] ddSetLogLevel:logLevel];
+        return;
+    }
+
+    SproutLogLevelSetForModule(className.UTF8String, (uint32_t)logLevel);
+}
+
++ (void)setLogLevelForAllClasses:(DDLogLevel)logLevel
+{
+    NSMutableArray<NSString *> *classNames = [NSMutableArray array];
+    NSMutableArray<Class> *selfManagedClasses = [NSMutableArray array];
+
+    os_unfair_lock_lock(&sproutRegistryLock);
+    sproutAddPendingClassNames();
+    for (NSString *className in sproutRegisteredClasses)
+    {
+        if ([sproutSelfManagedClassNames containsObject:className])
+        {
+            [selfManagedClasses addObject:sproutRegisteredClasses[className]];
+        }
+        else
+        {
+            [classNames addObject:className];
+        }
+    }
+    os_unfair_lock_unlock(&sproutRegistryLock);
+
+    if (classNames.count > 0)
+    {
+        const char **modules = malloc(classNames.count * sizeof(const char *));
+        for (NSUInteger i = 0; i < classNames.count; ++i)
+        {
+            modules[i] = classNames[i].UTF8String;
+        }
+        SproutLogLevelSetForModules(modules, classNames.count, (uint32_t)logLevel);
+        free(modules);
+    }
+
+    //Outside the lock, as the classes' own methods may use the registry
+    for (Class<DDRegisteredDynamicLogging> aClass in selfManagedClasses)
+    {
+        [aClass ddSetLogLevel:logLevel];
+    }
+}
+
+#pragma mark Helpers
+
++ (BOOL)isSelfManagedClassWithName:(NSString *)className
+{
+    os_unfair_lock_lock(&sproutRegistryLock);
+    sproutAddPendingClassNames();
+    BOOL retVal = className && [sproutSelfManagedClassNames containsObject:className];
+    os_unfair_lock_unlock(&sproutRegistryLock);
+
+    return retVal;
+}
+
+@end
@@ -0,0 +1,169 @@
+//
+//  SproutLogLevels.h
+//
+//  Part of "Sprout" https://github.com/levigroker/Sprout
+//
+//  Created on October 19, 2026.
+//  Copyright (c) 2026 Levi Brown <mailto:levigroker@gmail.com> This work is
+//  licensed under the Creative Commons Attribution 4.0 International License. To
+//  view a copy of this license, visit https://creativecommons.org/licenses/by/4.0/
+//  or send a letter to Creative Commons, PO Box 1866, Mountain View, CA 94042, USA.
+//
+//  The above attribution and the included license must accompany any version of
+//  the source code, binary distributable, or derivatives.
+//
+
+/**
+ The process wide dynamic log level, with optional per-context and per-module levels.
+ This header is plain C, so it can be used from any translation unit.
+
+ `Sprout.h` defines `LOG_LEVEL_DEF` as `SproutLogLevelCurrent()` (unless `SPROUT_DISABLE_DYNAMIC_LOG_LEVEL` is defined), and
+ `SproutLogMacros.h` redefines `LOG_MAYBE` to check it with `SproutLogLevelIsEnabled`, so the level check in every
+ `DDLog...` statement is a single relaxed atomic load and a test, unless a per-context or per-module level is set.
+ While any are set, the state carries the `SPROUT_LOG_LEVEL_OVERRIDDEN` bit, and the check looks the statement up in
+ the current level table.
+
+ A statement's module is `SPROUT_LOG_MODULE`, which is `__FILE__` unless it is defined before `Sprout.h` is imported (e.g.
+ `SPROUT_LOG_MODULE="Networking"` for a whole target). A module level applies to statements whose module is the given
+ name, or whose module is a path with the given file name (without extension), e.g. "MyViewController".
+ Where both apply, a module level takes precedence over a context level, which takes precedence over the global level.
+ */
+
+#ifndef _SPROUT_LOG_LEVELS_H
+#define _SPROUT_LOG_LEVELS_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#ifndef SPROUT_LOG_MODULE
+    #define SPROUT_LOG_MODULE __FILE__
+#endif
+
+//The log level bits of the state
+#define SPROUT_LOG_LEVEL_MASK 0xFFFFu
+//Set in the state while any per-context or per-module levels are set
+#define SPROUT_LOG_LEVEL_OVERRIDDEN (1u << 31)
+
+//Only written by the functions below
+extern uint32_t _SproutLogLevelState;
+
+/**
+ @return The current log level state: the global log level, and the `SPROUT_LOG_LEVEL_OVERRIDDEN` bit.
+ */
+static inline uint32_t SproutLogLevelCurrent(void)
+{
+    return __atomic_load_n(&_SproutLogLevelState, __ATOMIC_RELAXED);
+}
+
+bool SproutLogLevelIsEnabledSlow(uint32_t state, uint32_t flag, intptr_t context, const char *module);
+
+/**
+ @param state The log level state (from `SproutLogLevelCurrent()`), or a static log level.
+ @param flag The `DDLogFlag` of the statement.
+ @param context The context of the statement.
+ @param module The module of the statement (see `SPROUT_LOG_MODULE`).
+ @return `true` if the statement should be logged.
+ */
+static inline bool SproutLogLevelIsEnabled(uint32_t state, uint32_t flag, intptr_t context, const char *module)
+{
+    if (__builtin_expect((state & SPROUT_LOG_LEVEL_OVERRIDDEN) != 0, 0))
+    {
+        return SproutLogLevelIsEnabledSlow(state, flag, context, module);
+    }
+    return (state & flag) != 0;
+}
+
+/**
+ @return The global log level.
+ */
+uint32_t SproutLogLevelGet(void);
+
+/**
+ Sets the global log level, which takes affect immediately in every translation unit.
+ */
+void SproutLogLevelSet(uint32_t level);
+
+/**
+ Sets the log level for statements logged with the given context.
+ */
+void SproutLogLevelSetForContext(intptr_t context, uint32_t level);
+
+/**
+ Raises the log level for statements logged with the given context, for the given number of seconds.
+ Until then, statements with a flag in `level` are logged whatever the other levels (a later call replaces the burst).
+ The burst ends by itself: no timer is involved, as the statements compare the time with the burst's deadline.
+ */
+void SproutLogLevelEnableForContext(intptr_t context, uint32_t level, double duration);
+
+/**
+ Removes the log level for the given context, so its statements use the global log level again (any burst continues).
+ */
+void SproutLogLevelRemoveForContext(intptr_t context);
+
+/**
+ @return `true` if a log level is set for the given context, in which case it is stored in `level`.
+ */
+bool SproutLogLevelLookupForContext(intptr_t context, uint32_t *level);
+
+/**
+ Sets the log level for statements in the given module (a `SPROUT_LOG_MODULE` name, or a file name without extension).
+ */
+void SproutLogLevelSetForModule(const char *module, uint32_t level);
+
+/**
+ Sets the same log level for each of the given modules, replacing the level table once.
+ */
+void SproutLogLevelSetForModules(const char * const *modules, size_t count, uint32_t level);
+
+/**
+ @return The log level set for the given module, or the global log level if there is none.
+ */
+uint32_t SproutLogLevelGetForModule(const char *module);
+
+/**
+ @return `true` if a log level is set for the given module, in which case it is stored in `level`.
+ */
+bool SproutLogLevelLookupForModule(const char *module, uint32_t *level);
+
+/**
+ Removes the log level for the given module, so its statements use the context or global log level again.
+ */
+void SproutLogLevelRemoveForModule(const char *module);
+
+/**
+ Removes all the per-context and per-module log levels.
+ */
+void SproutLogLevelRemoveAll(void);
+
+/**
+ Replaces the global log level and all the per-context and per-module log levels at once, so statements see either the
+ old levels or the new ones, never a mixture.
+ */
+void SproutLogLevelReplaceAll(uint32_t level,
+                              const intptr_t *contexts, const uint32_t *contextLevels, size_t contextCount,
+                              const char * const *modules, const uint32_t *moduleLevels, size_t moduleCount);
+
+/**
+ Changes the given log levels at once, so statements see either the old levels or the new ones, never a mixture. The
+ other per-context and per-module log levels (and bursts) are kept.
+
+ @param level The new global log level, or `NULL` to keep it.
+ @param removedContexts The contexts whose log levels are removed.
+ @param removedModules The modules whose log levels are removed. Levels in `modules` are set after the removals.
+ */
+void SproutLogLevelUpdate(const uint32_t *level,
+                          const intptr_t *contexts, const uint32_t *contextLevels, size_t contextCount,
+                          const intptr_t *removedContexts, size_t removedContextCount,
+                          const char * const *modules, const uint32_t *moduleLevels, size_t moduleCount,
+                          const char * const *removedModules, size_t removedModuleCount);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _SPROUT_LOG_LEVELS_H */
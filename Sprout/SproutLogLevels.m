@@ -0,0 +1,701 @@
+//
+//  SproutLogLevels.m
+//
+//  Part of "Sprout" https://github.com/levigroker/Sprout
+//
+//  Created on October 19, 2026.
+//  Copyright (c) 2026 Levi Brown <mailto:levigroker@gmail.com> This work is
+//  licensed under the Creative Commons Attribution 4.0 International License. To
+//  view a copy of this license, visit https://creativecommons.org/licenses/by/4.0/
+//  or send a letter to Creative Commons, PO Box 1866, Mountain View, CA 94042, USA.
+//
+//  The above attribution and the included license must accompany any version of
+//  the source code, binary distributable, or derivatives.
+//
+
+#include <os/lock.h>
+#include <pthread.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#import "Sprout.h"
+#import "SproutLogLevels.h"
+
+uint32_t _SproutLogLevelState = SPROUT_DEFAULT_LOG_LEVEL & SPROUT_LOG_LEVEL_MASK;
+
+typedef struct
+{
+    intptr_t context;
+    //`false` if only a burst is set for the context
+    bool hasLevel;
+    uint32_t level;
+    //Raises the context's level until the deadline (of `sproutMonotonicTime()`), if non-zero
+    uint32_t burstLevel;
+    uint64_t burstDeadline;
+} SproutContextLogLevel;
+
+typedef struct
+{
+    const char *module;
+    size_t length;
+    uint32_t level;
+} SproutModuleLogLevel;
+
+//Immutable once published
+typedef struct SproutLogLevelTable
+{
+    size_t contextCount;
+    size_t moduleCount;
+    SproutContextLogLevel *contexts;
+    SproutModuleLogLevel *modules;
+    //The next superseded table waiting to be freed
+    struct SproutLogLevelTable *nextRetired;
+} SproutLogLevelTable;
+
+static SproutLogLevelTable *sproutLogLevelTable = NULL;
+static os_unfair_lock sproutLogLevelLock = OS_UNFAIR_LOCK_INIT;
+
+//Superseded tables can't be freed while a statement may still be reading one. Each thread that reads a table publishes
+//it in its own hazard slot first (see `sproutTableAcquire`), so statements never write memory shared with other threads.
+//Superseded tables are retired, and freed by the next change of the levels once no slot holds them, so at most one
+//retired table per thread reading a table is ever waiting to be freed.
+typedef struct SproutTableHazard
+{
+    //The table the thread is reading, if any
+    const struct SproutLogLevelTable *table;
+    //`false` once the thread has exited, so another thread can take the slot
+    bool inUse;
+    //Slots are never freed, so the list can be walked without the lock
+    struct SproutTableHazard *next;
+} SproutTableHazard;
+
+static SproutTableHazard *sproutTableHazards = NULL;
+static _Thread_local SproutTableHazard *sproutThreadTableHazard = NULL;
+static pthread_key_t sproutTableHazardKey;
+static pthread_once_t sproutTableHazardKeyOnce = PTHREAD_ONCE_INIT;
+static SproutLogLevelTable *sproutRetiredTables = NULL;
+
+//Module names are interned (and kept for the life of the process), so tables share them rather than copying them
+static const char **sproutModuleNames = NULL;
+static size_t sproutModuleNameCount = 0;
+
+#pragma mark - Helpers
+
+//Nanoseconds, including while the device sleeps
+static inline uint64_t sproutMonotonicTime(void)
+{
+    return clock_gettime_nsec_np(CLOCK_MONOTONIC_RAW);
+}
+
+//Whether `module` is `name`, or a path to a file named `name` (plus an extension)
+static bool sproutModuleMatches(const char *module, const SproutModuleLogLevel *entry)
+{
+    if (strcmp(module, entry->module) == 0)
+    {
+        return true;
+    }
+
+    const char *fileName = strrchr(module, '/');
+    fileName = fileName ? fileName + 1 : module;
+
+    return strncmp(fileName, entry->module, entry->length) == 0 && (fileName[entry->length] == '.' || fileName[entry->length] == '\0');
+}
+
+//Must be called with the lock held
+static const char *sproutInternModuleName(const char *module)
+{
+    for (size_t i = 0; i < sproutModuleNameCount; ++i)
+    {
+        if (strcmp(sproutModuleNames[i], module) == 0)
+        {
+            return sproutModuleNames[i];
+        }
+    }
+
+    sproutModuleNames = realloc(sproutModuleNames, (sproutModuleNameCount + 1) * sizeof(const char *));
+    sproutModuleNames[sproutModuleNameCount] = strdup(module);
+    return sproutModuleNames[sproutModuleNameCount++];
+}
+
+static void sproutTableHazardThreadExit(void *value)
+{
+    SproutTableHazard *hazard = value;
+    sproutThreadTableHazard = NULL;
+    __atomic_store_n(&hazard->table, NULL, __ATOMIC_RELAXED);
+    __atomic_store_n(&hazard->inUse, false, __ATOMIC_RELEASE);
+}
+
+static void sproutTableHazardKeyCreate(void)
+{
+    pthread_key_create(&sproutTableHazardKey, sproutTableHazardThreadExit);
+}
+
+//Once per thread: takes the slot of an exited thread, or adds one
+static __attribute__((noinline)) SproutTableHazard *sproutTableHazardCreate(void)
+{
+    pthread_once(&sproutTableHazardKeyOnce, sproutTableHazardKeyCreate);
+
+    SproutTableHazard *retVal = NULL;
+    for (SproutTableHazard *hazard = __atomic_load_n(&sproutTableHazards, __ATOMIC_ACQUIRE); hazard && !retVal; hazard = hazard->next)
+    {
+        bool inUse = false;
+        if (__atomic_compare_exchange_n(&hazard->inUse, &inUse, true, false, __ATOMIC_ACQUIRE, __ATOMIC_RELAXED))
+        {
+            retVal = hazard;
+        }
+    }
+
+    if (!retVal)
+    {
+        retVal = calloc(1, sizeof(SproutTableHazard));
+        retVal->inUse = true;
+        retVal->next = __atomic_load_n(&sproutTableHazards, __ATOMIC_RELAXED);
+        while (!__atomic_compare_exchange_n(&sproutTableHazards, &retVal->next, retVal, true, __ATOMIC_RELEASE, __ATOMIC_RELAXED))
+        {
+        }
+    }
+
+    pthread_setspecific(sproutTableHazardKey, retVal);
+    sproutThreadTableHazard = retVal;
+    return retVal;
+}
+
+//The table is published in the thread's slot, then loaded again: if it is still current, a change of the levels that
+//supersedes it is ordered after the slot holding it, so will see it. Must not be nested on a thread.
+static inline const SproutLogLevelTable *sproutTableAcquire(void)
+{
+    SproutTableHazard *hazard = sproutThreadTableHazard;
+    if (__builtin_expect(hazard == NULL, 0))
+    {
+        hazard = sproutTableHazardCreate();
+    }
+
+    const SproutLogLevelTable *retVal = __atomic_load_n(&sproutLogLevelTable, __ATOMIC_ACQUIRE);
+    while (true)
+    {
+        __atomic_store_n(&hazard->table, retVal, __ATOMIC_SEQ_CST);
+        const SproutLogLevelTable *current = __atomic_load_n(&sproutLogLevelTable, __ATOMIC_SEQ_CST);
+        if (current == retVal)
+        {
+            return retVal;
+        }
+        retVal = current;
+    }
+}
+
+static inline void sproutTableRelease(void)
+{
+    __atomic_store_n(&sproutThreadTableHazard->table, NULL, __ATOMIC_RELEASE);
+}
+
+static void sproutFreeTable(SproutLogLevelTable *table)
+{
+    free(table->contexts);
+    free(table->modules);
+    free(table);
+}
+
+static bool sproutTableIsHazard(const SproutLogLevelTable *table)
+{
+    for (SproutTableHazard *hazard = __atomic_load_n(&sproutTableHazards, __ATOMIC_ACQUIRE); hazard; hazard = hazard->next)
+    {
+        if (__atomic_load_n(&hazard->table, __ATOMIC_SEQ_CST) == table)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+//Must be called with the lock held, after the superseding table is published (with `__ATOMIC_SEQ_CST`, so a reader
+//either loads the new table, or its slot is seen here)
+static void sproutFreeRetiredTables(void)
+{
+    SproutLogLevelTable **link = &sproutRetiredTables;
+    while (*link)
+    {
+        SproutLogLevelTable *table = *link;
+        if (sproutTableIsHazard(table))
+        {
+            link = &table->nextRetired;
+        }
+        else
+        {
+            *link = table->nextRetired;
+            sproutFreeTable(table);
+        }
+    }
+}
+
+static SproutLogLevelTable *sproutCopyTable(const SproutLogLevelTable *table, size_t extraContexts, size_t extraModules)
+{
+    size_t contextCount = table ? table->contextCount : 0;
+    size_t moduleCount = table ? table->moduleCount : 0;
+
+    SproutLogLevelTable *retVal = calloc(1, sizeof(SproutLogLevelTable));
+    retVal->contexts = calloc(contextCount + extraContexts + 1, sizeof(SproutContextLogLevel));
+    retVal->modules = calloc(moduleCount + extraModules + 1, sizeof(SproutModuleLogLevel));
+    if (table)
+    {
+        memcpy(retVal->contexts, table->contexts, contextCount * sizeof(SproutContextLogLevel));
+        memcpy(retVal->modules, table->modules, moduleCount * sizeof(SproutModuleLogLevel));
+    }
+    retVal->contextCount = contextCount;
+    retVal->moduleCount = moduleCount;
+    retVal->nextRetired = NULL;
+
+    return retVal;
+}
+
+//Must be called with the lock held
+static void sproutPublishTableAndLevel(SproutLogLevelTable *table, uint32_t level)
+{
+    if (table && table->contextCount == 0 && table->moduleCount == 0)
+    {
+        sproutFreeTable(table);
+        table = NULL;
+    }
+
+    SproutLogLevelTable *superseded = sproutLogLevelTable;
+    __atomic_store_n(&sproutLogLevelTable, table, __ATOMIC_SEQ_CST);
+    if (superseded && superseded != table)
+    {
+        superseded->nextRetired = sproutRetiredTables;
+        sproutRetiredTables = superseded;
+    }
+    sproutFreeRetiredTables();
+
+    uint32_t state = level & SPROUT_LOG_LEVEL_MASK;
+    if (table)
+    {
+        state |= SPROUT_LOG_LEVEL_OVERRIDDEN;
+    }
+    __atomic_store_n(&_SproutLogLevelState, state, __ATOMIC_RELEASE);
+}
+
+//Must be called with the lock held
+static void sproutPublishTable(SproutLogLevelTable *table)
+{
+    sproutPublishTableAndLevel(table, __atomic_load_n(&_SproutLogLevelState, __ATOMIC_RELAXED));
+}
+
+//Drops the expired bursts from the given (unpublished) table
+static void sproutRemoveExpiredBursts(SproutLogLevelTable *table, uint64_t now)
+{
+    size_t count = 0;
+    for (size_t i = 0; i < table->contextCount; ++i)
+    {
+        SproutContextLogLevel entry = table->contexts[i];
+        if (entry.burstDeadline != 0 && entry.burstDeadline <= now)
+        {
+            entry.burstLevel = 0;
+            entry.burstDeadline = 0;
+        }
+        if (entry.hasLevel || entry.burstDeadline != 0)
+        {
+            table->contexts[count++] = entry;
+        }
+    }
+    table->contextCount = count;
+}
+
+//Called by statements which find an expired burst, so the table (and the overridden state, if it was only set for the
+//burst) is cleaned up without a timer. Skipped if another thread is changing the levels.
+static void sproutRemoveExpiredBurstsIfPossible(void)
+{
+    if (!os_unfair_lock_trylock(&sproutLogLevelLock))
+    {
+        return;
+    }
+
+    SproutLogLevelTable *table = sproutCopyTable(sproutLogLevelTable, 0, 0);
+    sproutRemoveExpiredBursts(table, sproutMonotonicTime());
+    sproutPublishTable(table);
+    os_unfair_lock_unlock(&sproutLogLevelLock);
+}
+
+#pragma mark - Levels
+
+//Must be called with a reference to the table (see `sproutTableAcquire`)
+static bool sproutTableIsEnabled(const SproutLogLevelTable *table, uint32_t state, uint32_t flag, intptr_t context, const char *module, bool *burstExpired)
+{
+    if (table)
+    {
+        //An active burst raises the context's level, whatever its other levels
+        for (size_t i = 0; i < table->contextCount; ++i)
+        {
+            const SproutContextLogLevel *entry = &table->contexts[i];
+            if (entry->context == context && entry->burstDeadline != 0)
+            {
+                if (sproutMonotonicTime() >= entry->burstDeadline)
+                {
+                    *burstExpired = true;
+                }
+                else if (entry->burstLevel & flag)
+                {
+                    return true;
+                }
+                break;
+            }
+        }
+
+        if (module)
+        {
+            for (size_t i = 0; i < table->moduleCount; ++i)
+            {
+                if (sproutModuleMatches(module, &table->modules[i]))
+                {
+                    return (table->modules[i].level & flag) != 0;
+                }
+            }
+        }
+
+        for (size_t i = 0; i < table->contextCount; ++i)
+        {
+            if (table->contexts[i].context == context && table->contexts[i].hasLevel)
+            {
+                return (table->contexts[i].level & flag) != 0;
+            }
+        }
+    }
+
+    return (state & SPROUT_LOG_LEVEL_MASK & flag) != 0;
+}
+
+bool SproutLogLevelIsEnabledSlow(uint32_t state, uint32_t flag, intptr_t context, const char *module)
+{
+    bool burstExpired = false;
+    const SproutLogLevelTable *table = sproutTableAcquire();
+    bool retVal = sproutTableIsEnabled(table, state, flag, context, module, &burstExpired);
+    sproutTableRelease();
+
+    //Once the table is released, so it can be freed when replaced
+    if (burstExpired)
+    {
+        sproutRemoveExpiredBurstsIfPossible();
+    }
+
+    return retVal;
+}
+
+uint32_t SproutLogLevelGet(void)
+{
+    uint32_t retVal = SproutLogLevelCurrent() & SPROUT_LOG_LEVEL_MASK;
+    //Report all the bits of `DDLogLevelAll`
+    return retVal == SPROUT_LOG_LEVEL_MASK ? UINT32_MAX : retVal;
+}
+
+void SproutLogLevelSet(uint32_t level)
+{
+    os_unfair_lock_lock(&sproutLogLevelLock);
+    //The published table is never empty, so is kept as is
+    sproutPublishTableAndLevel(sproutLogLevelTable, level);
+    os_unfair_lock_unlock(&sproutLogLevelLock);
+}
+
+void SproutLogLevelSetForContext(intptr_t context, uint32_t level)
+{
+    os_unfair_lock_lock(&sproutLogLevelLock);
+    SproutLogLevelTable *table = sproutCopyTable(sproutLogLevelTable, 1, 0);
+
+    size_t i = 0;
+    while (i < table->contextCount && table->contexts[i].context != context)
+    {
+        ++i;
+    }
+    if (i == table->contextCount)
+    {
+        table->contextCount++;
+    }
+    table->contexts[i].context = context;
+    table->contexts[i].hasLevel = true;
+    table->contexts[i].level = level & SPROUT_LOG_LEVEL_MASK;
+
+    sproutPublishTable(table);
+    os_unfair_lock_unlock(&sproutLogLevelLock);
+}
+
+void SproutLogLevelRemoveForContext(intptr_t context)
+{
+    os_unfair_lock_lock(&sproutLogLevelLock);
+    SproutLogLevelTable *table = sproutCopyTable(sproutLogLevelTable, 0, 0);
+
+    for (size_t i = 0; i < table->contextCount; ++i)
+    {
+        if (table->contexts[i].context == context)
+        {
+            table->contexts[i].hasLevel = false;
+        }
+    }
+    //Drops the entry, unless it has a burst
+    sproutRemoveExpiredBursts(table, sproutMonotonicTime());
+
+    sproutPublishTable(table);
+    os_unfair_lock_unlock(&sproutLogLevelLock);
+}
+
+bool SproutLogLevelLookupForContext(intptr_t context, uint32_t *level)
+{
+    bool retVal = false;
+
+    const SproutLogLevelTable *table = sproutTableAcquire();
+    for (size_t i = 0; table && i < table->contextCount; ++i)
+    {
+        if (table->contexts[i].context == context && table->contexts[i].hasLevel)
+        {
+            retVal = true;
+            *level = table->contexts[i].level == SPROUT_LOG_LEVEL_MASK ? UINT32_MAX : table->contexts[i].level;
+            break;
+        }
+    }
+    sproutTableRelease();
+
+    return retVal;
+}
+
+void SproutLogLevelSetForModule(const char *module, uint32_t level)
+{
+    SproutLogLevelSetForModules(&module, 1, level);
+}
+
+void SproutLogLevelSetForModules(const char * const *modules, size_t count, uint32_t level)
+{
+    if (!modules || count == 0)
+    {
+        return;
+    }
+
+    os_unfair_lock_lock(&sproutLogLevelLock);
+    SproutLogLevelTable *table = sproutCopyTable(sproutLogLevelTable, 0, count);
+
+    for (size_t m = 0; m < count; ++m)
+    {
+        const char *module = modules[m];
+        if (!module)
+        {
+            continue;
+        }
+
+        size_t i = 0;
+        while (i < table->moduleCount && strcmp(table->modules[i].module, module) != 0)
+        {
+            ++i;
+        }
+        if (i == table->moduleCount)
+        {
+            table->moduleCount++;
+            table->modules[i].module = sproutInternModuleName(module);
+            table->modules[i].length = strlen(module);
+        }
+        table->modules[i].level = level & SPROUT_LOG_LEVEL_MASK;
+    }
+
+    sproutPublishTable(table);
+    os_unfair_lock_unlock(&sproutLogLevelLock);
+}
+
+bool SproutLogLevelLookupForModule(const char *module, uint32_t *level)
+{
+    bool retVal = false;
+
+    const SproutLogLevelTable *table = sproutTableAcquire();
+    for (size_t i = 0; table && module && i < table->moduleCount; ++i)
+    {
+        if (strcmp(table->modules[i].module, module) == 0)
+        {
+            retVal = true;
+            *level = table->modules[i].level == SPROUT_LOG_LEVEL_MASK ? UINT32_MAX : table->modules[i].level;
+            break;
+        }
+    }
+    sproutTableRelease();
+
+    return retVal;
+}
+
+uint32_t SproutLogLevelGetForModule(const char *module)
+{
+    uint32_t retVal = 0;
+    return SproutLogLevelLookupForModule(module, &retVal) ? retVal : SproutLogLevelGet();
+}
+
+void SproutLogLevelRemoveForModule(const char *module)
+{
+    if (!module)
+    {
+        return;
+    }
+
+    os_unfair_lock_lock(&sproutLogLevelLock);
+    SproutLogLevelTable *table = sproutCopyTable(sproutLogLevelTable, 0, 0);
+
+    size_t count = 0;
+    for (size_t i = 0; i < table->moduleCount; ++i)
+    {
+        if (strcmp(table->modules[i].module, module) != 0)
+        {
+            table->modules[count++] = table->modules[i];
+        }
+    }
+    table->moduleCount = count;
+
+    sproutPublishTable(table);
+    os_unfair_lock_unlock(&sproutLogLevelLock);
+}
+
+void SproutLogLevelRemoveAll(void)
+{
+    os_unfair_lock_lock(&sproutLogLevelLock);
+    sproutPublishTable(NULL);
+    os_unfair_lock_unlock(&sproutLogLevelLock);
+}
+
+void SproutLogLevelReplaceAll(uint32_t level,
+                              const intptr_t *contexts, const uint32_t *contextLevels, size_t contextCount,
+                              const char * const *modules, const uint32_t *moduleLevels, size_t moduleCount)
+{
+    os_unfair_lock_lock(&sproutLogLevelLock);
+
+    //Active bursts are kept
+    const SproutLogLevelTable *current = sproutLogLevelTable;
+    SproutLogLevelTable *table = sproutCopyTable(NULL, contextCount + (current ? current->contextCount : 0), moduleCount);
+    if (current)
+    {
+        for (size_t i = 0; i < current->contextCount; ++i)
+        {
+            if (current->contexts[i].burstDeadline != 0)
+            {
+                SproutContextLogLevel *entry = &table->contexts[table->contextCount++];
+                *entry = current->contexts[i];
+                entry->hasLevel = false;
+            }
+        }
+    }
+
+    for (size_t c = 0; c < contextCount; ++c)
+    {
+        size_t i = 0;
+        while (i < table->contextCount && table->contexts[i].context != contexts[c])
+        {
+            ++i;
+        }
+        if (i == table->contextCount)
+        {
+            table->contextCount++;
+            table->contexts[i].context = contexts[c];
+        }
+        table->contexts[i].hasLevel = true;
+        table->contexts[i].level = contextLevels[c] & SPROUT_LOG_LEVEL_MASK;
+    }
+    sproutRemoveExpiredBursts(table, sproutMonotonicTime());
+
+    for (size_t i = 0; i < moduleCount; ++i)
+    {
+        table->modules[i].module = sproutInternModuleName(modules[i]);
+        table->modules[i].length = strlen(modules[i]);
+        table->modules[i].level = moduleLevels[i] & SPROUT_LOG_LEVEL_MASK;
+    }
+    table->moduleCount = moduleCount;
+
+    sproutPublishTableAndLevel(table, level);
+    os_unfair_lock_unlock(&sproutLogLevelLock);
+}
+
+void SproutLogLevelUpdate(const uint32_t *level,
+                          const intptr_t *contexts, const uint32_t *contextLevels, size_t contextCount,
+                          const intptr_t *removedContexts, size_t removedContextCount,
+                          const char * const *modules, const uint32_t *moduleLevels, size_t moduleCount,
+                          const char * const *removedModules, size_t removedModuleCount)
+{
+    os_unfair_lock_lock(&sproutLogLevelLock);
+    SproutLogLevelTable *table = sproutCopyTable(sproutLogLevelTable, contextCount, moduleCount);
+
+    for (size_t c = 0; c < removedContextCount; ++c)
+    {
+        for (size_t i = 0; i < table->contextCount; ++i)
+        {
+            if (table->contexts[i].context == removedContexts[c])
+            {
+                table->contexts[i].hasLevel = false;
+            }
+        }
+    }
+    for (size_t c = 0; c < contextCount; ++c)
+    {
+        size_t i = 0;
+        while (i < table->contextCount && table->contexts[i].context != contexts[c])
+        {
+            ++i;
+        }
+        if (i == table->contextCount)
+        {
+            table->contextCount++;
+            table->contexts[i].context = contexts[c];
+        }
+        table->contexts[i].hasLevel = true;
+        table->contexts[i].level = contextLevels[c] & SPROUT_LOG_LEVEL_MASK;
+    }
+    //Drops the removed entries, unless they have a burst
+    sproutRemoveExpiredBursts(table, sproutMonotonicTime());
+
+    size_t count = 0;
+    for (size_t i = 0; i < table->moduleCount; ++i)
+    {
+        bool removed = false;
+        for (size_t m = 0; m < removedModuleCount && !removed; ++m)
+        {
+            removed = strcmp(table->modules[i].module, removedModules[m]) == 0;
+        }
+        if (!removed)
+        {
+            table->modules[count++] = table->modules[i];
+        }
+    }
+    table->moduleCount = count;
+    for (size_t m = 0; m < moduleCount; ++m)
+    {
+        size_t i = 0;
+        while (i < table->moduleCount && strcmp(table->modules[i].module, modules[m]) != 0)
+        {
+            ++i;
+        }
+        if (i == table->moduleCount)
+        {
+            table->moduleCount++;
+            table->modules[i].module = sproutInternModuleName(modules[m]);
+            table->modules[i].length = strlen(modules[m]);
+        }
+        table->modules[i].level = moduleLevels[m] & SPROUT_LOG_LEVEL_MASK;
+    }
+
+    sproutPublishTableAndLevel(table, level ? *level : __atomic_load_n(&_SproutLogLevelState, __ATOMIC_RELAXED));
+    os_unfair_lock_unlock(&sproutLogLevelLock);
+}
+
+void SproutLogLevelEnableForContext(intptr_t context, uint32_t level, double duration)
+{
+    if (!(duration > 0))
+    {
+        return;
+    }
+
+    os_unfair_lock_lock(&sproutLogLevelLock);
+    SproutLogLevelTable *table = sproutCopyTable(sproutLogLevelTable, 1, 0);
+
+    size_t i = 0;
+    while (i < table->contextCount && table->contexts[i].context != context)
+    {
+        ++i;
+    }
+    if (i == table->contextCount)
+    {
+        table->contextCount++;
+        table->contexts[i].context = context;
+    }
+    table->contexts[i].burstLevel = level & SPROUT_LOG_LEVEL_MASK;
+    table->contexts[i].burstDeadline = sproutMonotonicTime() + (uint64_t)(duration * NSEC_PER_SEC);
+
+    sproutPublishTable(table);
+    os_unfair_lock_unlock(&sproutLogLevelLock);
+}
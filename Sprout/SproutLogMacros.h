@@ -0,0 +1,103 @@
+//
+//  SproutLogMacros.h
+//
+//  Part of "Sprout" https://github.com/levigroker/Sprout
+//
+//  Created on October 19, 2026.
+//  Copyright (c) 2026 Levi Brown <mailto:levigroker@gmail.com> This work is
+//  licensed under the Creative Commons Attribution 4.0 International License. To
+//  view a copy of this license, visit https://creativecommons.org/licenses/by/4.0/
+//  or send a letter to Creative Commons, PO Box 1866, Mountain View, CA 94042, USA.
+//
+//  The above attribution and the included license must accompany any version of
+//  the source code, binary distributable, or derivatives.
+//
+
+/**
+ Redefines CocoaLumberjack's `LOG_MACRO` (which all the `DDLog...` and `SproutLog...` macros expand to) so messages logged
+ without a tag capture the current thread's `SproutDiagnosticContext` as their tag (`representedObject`).
+ Capturing the context only reads a thread local pointer. Imported by `Sprout.h`.
+
+ `LOG_MACRO` calls `SproutLogCold`, an out of line function marked cold, rather than sending the variadic
+ `+[DDLog log:level:flag:context:file:function:line:tag:format:]` message itself. So the code a statement adds to the
+ function it is in is the level check and a single call, and the compiler moves even that call out of the hot path.
+
+ Also redefines `LOG_MAYBE` to check the level with `SPROUT_LOG_ENABLED`, so per-context and per-module levels
+ (see SproutLogLevels.h), call sites (see SproutLogCallSites.h) and `SPROUT_MODULE_MAX_LEVEL` apply. For a static
+ level this folds away exactly as CocoaLumberjack's `(lvl & flg)` does.
+ */
+
+#ifndef _SPROUT_LOG_MACROS_H
+#define _SPROUT_LOG_MACROS_H
+
+#import <CocoaLumberjack/CocoaLumberjack.h>
+#import "SproutDiagnosticContext.h"
+#import "SproutLogLevels.h"
+#import "SproutLogCallSites.h"
+
+static inline id SproutLogTag(id tag)
+{
+    return tag ?: SproutDiagnosticContextCurrent();
+}
+
+/**
+ Logs a message with `+[DDLog log:level:flag:context:file:function:line:tag:format:args:]`, after masking the level and
+ capturing the diagnostic context as the tag (if there is no tag).
+ */
+FOUNDATION_EXPORT void SproutLogCold(BOOL asynchronous, DDLogLevel level, DDLogFlag flag, NSInteger context, const char *file, const char *function, NSUInteger line, id tag, NSString *format, ...)
+    __attribute__((cold, noinline)) NS_FORMAT_FUNCTION(9,10);
+
+/**
+ As `SproutLogCold`, but logs to the given `DDLog` instance.
+ */
+FOUNDATION_EXPORT void SproutLogToDDLogCold(DDLog *ddlog, BOOL asynchronous, DDLogLevel level, DDLogFlag flag, NSInteger context, const char *file, const char *function, NSUInteger line, id tag, NSString *format, ...)
+    __attribute__((cold, noinline)) NS_FORMAT_FUNCTION(10,11);
+
+/**
+ As `SproutLogCold`, but with a message rather than a format, so it can be called from Swift (see SproutLog.swift).
+ */
+FOUNDATION_EXPORT void SproutLogMessageCold(BOOL asynchronous, DDLogLevel level, DDLogFlag flag, NSInteger context, const char *file, const char *function, NSUInteger line, id tag, NSString *message)
+    __attribute__((cold, noinline));
+
+#undef LOG_MACRO
+#define LOG_MACRO(isAsynchronous, lvl, flg, ctx, atag, fnct, frmt, ...) \
+        SproutLogCold(isAsynchronous, (DDLogLevel)(lvl), flg, ctx, __FILE__, fnct, __LINE__, atag, (frmt), ## __VA_ARGS__)
+
+#undef LOG_MACRO_TO_DDLOG
+#define LOG_MACRO_TO_DDLOG(ddlog, isAsynchronous, lvl, flg, ctx, atag, fnct, frmt, ...) \
+        SproutLogToDDLogCold(ddlog, isAsynchronous, (DDLogLevel)(lvl), flg, ctx, __FILE__, fnct, __LINE__, atag, (frmt), ## __VA_ARGS__)
+
+/**
+ A compile time ceiling for the statements of a module (a target or a file): statements whose flag is not in
+ `SPROUT_MODULE_MAX_LEVEL` are compiled out entirely, while the rest stay subject to the dynamic log levels.
+ Define it for a target in its build settings (i.e. `SPROUT_MODULE_MAX_LEVEL=DDLogLevelInfo`), or for a file by
+ redefining it after importing `Sprout.h`, as it is expanded where each statement is.
+ */
+#ifndef SPROUT_MODULE_MAX_LEVEL
+    #define SPROUT_MODULE_MAX_LEVEL DDLogLevelAll
+#endif
+
+//Whether a statement should be logged. `flg` and `fnct` must be constants.
+#define SPROUT_LOG_ENABLED(lvl, flg, ctx, fnct) \
+        ((((flg) & (SPROUT_MODULE_MAX_LEVEL)) != 0) && SPROUT_LOG_ENABLED_DYNAMIC(lvl, flg, ctx, fnct))
+
+#if SPROUT_DISABLE_DYNAMIC_LOG_LEVEL || SPROUT_DISABLE_LOG_CALL_SITES
+    #define SPROUT_LOG_ENABLED_DYNAMIC(lvl, flg, ctx, fnct) \
+            SproutLogLevelIsEnabled((lvl), (flg), (ctx), SPROUT_LOG_MODULE)
+#else
+    #define SPROUT_LOG_ENABLED_DYNAMIC(lvl, flg, ctx, fnct)                                                         \
+            ({                                                                                                       \
+                static SproutLogCallSite sproutLogCallSite SPROUT_LOG_CALL_SITE_SECTION = { 0, (uint8_t)(flg), __LINE__, __FILE__, (fnct) }; \
+                SproutLogCallSiteIsEnabled(&sproutLogCallSite, (lvl), (flg), (ctx), SPROUT_LOG_MODULE);              \
+            })
+#endif
+
+#undef LOG_MAYBE
+#define LOG_MAYBE(async, lvl, flg, ctx, tag, fnct, frmt, ...) \
+        do { if (SPROUT_LOG_ENABLED(lvl, flg, ctx, fnct)) LOG_MACRO(async, lvl, flg, ctx, tag, fnct, frmt, ##__VA_ARGS__); } while (0)
+
+#undef LOG_MAYBE_TO_DDLOG
+#define LOG_MAYBE_TO_DDLOG(ddlog, async, lvl, flg, ctx, tag, fnct, frmt, ...) \
+        do { if (SPROUT_LOG_ENABLED(lvl, flg, ctx, fnct)) LOG_MACRO_TO_DDLOG(ddlog, async, lvl, flg, ctx, tag, fnct, frmt, ##__VA_ARGS__); } while (0)
+
+#endif /* _SPROUT_LOG_MACROS_H */
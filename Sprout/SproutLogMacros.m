@@ -0,0 +1,37 @@
+//
+//  SproutLogMacros.m
+//
+//  Part of "Sprout" https://github.com/levigroker/Sprout
+//
+//  Created on October 19, 2026.
+//  Copyright (c) 2026 Levi Brown <mailto:levigroker@gmail.com> This work is
+//  licensed under the Creative Commons Attribution 4.0 International License. To
+//  view a copy of this license, visit https://creativecommons.org/licenses/by/4.0/
+//  or send a letter to Creative Commons, PO Box 1866, Mountain View, CA 94042, USA.
+//
+//  The above attribution and the included license must accompany any version of
+//  the source code, binary distributable, or derivatives.
+//
+
+#import "SproutLogMacros.h"
+
+void SproutLogCold(BOOL asynchronous, DDLogLevel level, DDLogFlag flag, NSInteger context, const char *file, const char *function, NSUInteger line, id tag, NSString *format, ...)
+{
+    va_list args;
+    va_start(args, format);
+    [DDLog log:asynchronous level:(DDLogLevel)(level & SPROUT_LOG_LEVEL_MASK) flag:flag context:context file:file function:function line:line tag:SproutLogTag(tag) format:format args:args];
+    va_end(args);
+}
+
+void SproutLogToDDLogCold(DDLog *ddlog, BOOL asynchronous, DDLogLevel level, DDLogFlag flag, NSInteger context, const char *file, const char *function, NSUInteger line, id tag, NSString *format, ...)
+{
+    va_list args;
+    va_start(args, format);
+    [ddlog log:asynchronous level:(DDLogLevel)(level & SPROUT_LOG_LEVEL_MASK) flag:flag context:context file:file function:function line:line tag:SproutLogTag(tag) format:format args:args];
+    va_end(args);
+}
+
+void SproutLogMessageCold(BOOL asynchronous, DDLogLevel level, DDLogFlag flag, NSInteger context, const char *file, const char *function, NSUInteger line, id tag, NSString *message)
+{
+    SproutLogCold(asynchronous, level, flag, context, file, function, line, tag, @"%@", message);
+}
@@ -0,0 +1,29 @@
+//
+//  SproutLogMessageSlots.h
+//
+//  Part of "Sprout" https://github.com/levigroker/Sprout
+//
+//  Created on October 19, 2026.
+//  Copyright (c) 2026 Levi Brown <mailto:levigroker@gmail.com> This work is
+//  licensed under the Creative Commons Attribution 4.0 International License. To
+//  view a copy of this license, visit https://creativecommons.org/licenses/by/4.0/
+//  or send a letter to Creative Commons, PO Box 1866, Mountain View, CA 94042, USA.
+//
+//  The above attribution and the included license must accompany any version of
+//  the source code, binary distributable, or derivatives.
+//
+
+#import <Foundation/Foundation.h>
+#import <CocoaLumberjack/CocoaLumberjack.h>
+
+/**
+ Result slots attached to a log message, so work done for one logger (i.e. redacting or formatting the message) can be
+ shared with the other loggers the message is delivered to, rather than repeated on every logger's queue.
+
+ @param logMessage The log message the result belongs to.
+ @param key Identifies the result (i.e. the address of the object which computes it). The object must outlive the message.
+ @param block Computes the result. Called at most once per message and key: if other threads need the same result while it
+ is being computed, they wait for it rather than computing it again.
+ @return The result of the block for the given message and key.
+ */
+extern id SproutLogMessageSlotValue(DDLogMessage *logMessage, const void *key, id (^NS_NOESCAPE block)(void));
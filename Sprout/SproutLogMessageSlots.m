@@ -0,0 +1,77 @@
+//
+//  SproutLogMessageSlots.m
+//
+//  Part of "Sprout" https://github.com/levigroker/Sprout
+//
+//  Created on October 19, 2026.
+//  Copyright (c) 2026 Levi Brown <mailto:levigroker@gmail.com> This work is
+//  licensed under the Creative Commons Attribution 4.0 International License. To
+//  view a copy of this license, visit https://creativecommons.org/licenses/by/4.0/
+//  or send a letter to Creative Commons, PO Box 1866, Mountain View, CA 94042, USA.
+//
+//  The above attribution and the included license must accompany any version of
+//  the source code, binary distributable, or derivatives.
+//
+
+#include <os/lock.h>
+#import <objc/runtime.h>
+
+#import "SproutLogMessageSlots.h"
+
+@interface SproutLogMessageSlot : NSObject
+{
+    @public
+    //Held while the value is computed, so other threads wait for it
+    os_unfair_lock _lock;
+    BOOL _computed;
+    id _value;
+}
+
+@end
+
+@implementation SproutLogMessageSlot
+
+- (instancetype)init
+{
+    if ((self = [super init]))
+    {
+        _lock = OS_UNFAIR_LOCK_INIT;
+    }
+
+    return self;
+}
+
+@end
+
+//Guards the creation of slots. Only held to look up (or attach) a slot, never while a value is computed.
+static os_unfair_lock sproutSlotsLock = OS_UNFAIR_LOCK_INIT;
+
+id SproutLogMessageSlotValue(DDLogMessage *logMessage, const void *key, id (^NS_NOESCAPE block)(void))
+{
+    if (!logMessage)
+    {
+        return block();
+    }
+
+    os_unfair_lock_lock(&sproutSlotsLock);
+    SproutLogMessageSlot *slot = objc_getAssociatedObject(logMessage, key);
+    if (!slot)
+    {
+        slot = [[SproutLogMessageSlot alloc] init];
+        objc_setAssociatedObject(logMessage, key, slot, OBJC_ASSOCIATION_RETAIN_NONATOMIC);
+    }
+    os_unfair_lock_unlock(&sproutSlotsLock);
+
+    //Computing a value may need the slots of other messages (i.e. a redacted copy of this one), but never this slot,
+    //so waiting on it can't deadlock.
+    os_unfair_lock_lock(&slot->_lock);
+    if (!slot->_computed)
+    {
+        slot->_value = block();
+        slot->_computed = YES;
+    }
+    id retVal = slot->_value;
+    os_unfair_lock_unlock(&slot->_lock);
+
+    return retVal;
+}
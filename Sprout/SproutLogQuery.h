@@ -0,0 +1,124 @@
+//
+//  SproutLogQuery.h
+//
+//  Part of "Sprout" https://github.com/levigroker/Sprout
+//
+//  Created on October 19, 2026.
+//  Copyright (c) 2026 Levi Brown <mailto:levigroker@gmail.com> This work is
+//  licensed under the Creative Commons Attribution 4.0 International License. To
+//  view a copy of this license, visit https://creativecommons.org/licenses/by/4.0/
+//  or send a letter to Creative Commons, PO Box 1866, Mountain View, CA 94042, USA.
+//
+//  The above attribution and the included license must accompany any version of
+//  the source code, binary distributable, or derivatives.
+//
+
+#import <Foundation/Foundation.h>
+#import <CocoaLumberjack/CocoaLumberjack.h>
+
+/**
+ Describes which log records should be returned by a `SproutLogQueryEngine` search.
+ Every criterion which is set must match for a record to be returned.
+ */
+@interface SproutLogQuery : NSObject <NSCopying>
+
+/**
+ Only records logged at or after this date will match. `nil` (the default) means no lower bound.
+ */
+@property (nonatomic, strong) NSDate *startDate;
+
+/**
+ Only records logged before this date will match. `nil` (the default) means no upper bound.
+ */
+@property (nonatomic, strong) NSDate *endDate;
+
+/**
+ A mask of `DDLogFlag` values to match. Defaults to `DDLogLevelAll`.
+ Note that `SproutCustomLogFormatter` writes both debug and verbose messages as `[DEBUG]`, so either flag will match them.
+ */
+@property (nonatomic, assign) DDLogFlag flags;
+
+/**
+ If set, only records logged with this context will match.
+ The context is only known for log formats which record it; records without a known context never match a context query.
+ `-[Sprout searchLogsWithQuery:resultsHandler:completion:]` instead searches only the files of the file logger the context
+ is routed to (see `-[Sprout setFileLogger:forContext:]`), when no other context is routed there.
+ */
+@property (nonatomic, strong) NSNumber *context;
+
+/**
+ If set, only records logged from a source file with this name (i.e. `Sprout.m`) will match.
+ */
+@property (nonatomic, copy) NSString *fileName;
+
+/**
+ If set, only records logged from a function whose name contains this string will match.
+ */
+@property (nonatomic, copy) NSString *function;
+
+/**
+ If set, only records whose message contains this string (case sensitive) will match.
+ */
+@property (nonatomic, copy) NSString *substring;
+
+/**
+ @param interval The time interval to look back from now.
+ @param flags The `DDLogFlag` mask to match.
+ @return A query matching records with the given flags logged within the given interval, i.e. "errors from the last hour".
+ */
++ (instancetype)queryForFlags:(DDLogFlag)flags withinLast:(NSTimeInterval)interval;
+
+@end
+
+/**
+ A single log record found by a `SproutLogQueryEngine` search.
+ */
+@interface SproutLogRecord : NSObject
+
+@property (nonatomic, strong, readonly) NSDate *timestamp;
+@property (nonatomic, assign, readonly) DDLogFlag flag;
+/**
+ The context the record was logged with, or `NSNotFound` if the log format does not record it.
+ */
+@property (nonatomic, assign, readonly) NSInteger context;
+@property (nonatomic, copy, readonly) NSString *threadID;
+@property (nonatomic, copy, readonly) NSString *function;
+@property (nonatomic, copy, readonly) NSString *fileName;
+@property (nonatomic, assign, readonly) NSUInteger line;
+@property (nonatomic, copy, readonly) NSString *message;
+/**
+ The path of the log file the record was found in.
+ */
+@property (nonatomic, copy, readonly) NSString *logFilePath;
+
+- (instancetype)initWithTimestamp:(NSDate *)timestamp flag:(DDLogFlag)flag context:(NSInteger)context threadID:(NSString *)threadID function:(NSString *)function fileName:(NSString *)fileName line:(NSUInteger)line message:(NSString *)message logFilePath:(NSString *)logFilePath;
+
+@end
+
+/**
+ Searches the live and archived log files of a `DDLogFileManager` for records written by `SproutCustomLogFormatter`.
+
+ Log files written by `SproutCompressedFileLogger` are decoded before being searched.
+ Log files are memory mapped and searched in parallel on a concurrent queue, with matching records streamed back as they are found.
+ Files which cannot contain matching records (based on their creation and modification dates) are not read at all.
+ Archived log files never change, so the first search of an archived file writes a small sidecar index (into a hidden
+ `.sproutindex` directory within the logs directory) which lets later searches skip straight to the regions of the file
+ which may contain matching records.
+ */
+@interface SproutLogQueryEngine : NSObject
+
+@property (nonatomic, strong, readonly) id<DDLogFileManager> logFileManager;
+
+- (instancetype)initWithLogFileManager:(id<DDLogFileManager>)logFileManager;
+
+/**
+ Asynchronously searches the log files for records matching the given query.
+
+ @param query The query describing the records to find.
+ @param resultsQueue The queue on which `resultsHandler` and `completion` are called. If `nil` the main queue is used.
+ @param resultsHandler Called (possibly many times) with batches of matching records as they are found. Records within a batch are in the order they were logged, but batches from different log files may arrive in any order.
+ @param completion Called once all log files have been searched. May be `nil`.
+ */
+- (void)searchWithQuery:(SproutLogQuery *)query resultsQueue:(dispatch_queue_t)resultsQueue resultsHandler:(void(^)(NSArray<SproutLogRecord *> *records))resultsHandler completion:(void(^)(void))completion;
+
+@end
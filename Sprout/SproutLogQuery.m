@@ -0,0 +1,726 @@
+//
+//  SproutLogQuery.m
+//
+//  Part of "Sprout" https://github.com/levigroker/Sprout
+//
+//  Created on October 19, 2026.
+//  Copyright (c) 2026 Levi Brown <mailto:levigroker@gmail.com> This work is
+//  licensed under the Creative Commons Attribution 4.0 International License. To
+//  view a copy of this license, visit https://creativecommons.org/licenses/by/4.0/
+//  or send a letter to Creative Commons, PO Box 1866, Mountain View, CA 94042, USA.
+//
+//  The above attribution and the included license must accompany any version of
+//  the source code, binary distributable, or derivatives.
+//
+
+#include <string.h>
+#include <time.h>
+
+#import "SproutLogQuery.h"
+#import "SproutCompressedFileLogger.h"
+
+static NSString * const kSproutLogIndexDirectoryName = @".sproutindex";
+static NSString * const kSproutLogIndexFileExtension = @"idx";
+static char const kSproutLogIndexMagic[8] = { 'S', 'P', 'R', 'T', 'I', 'D', 'X', '1' };
+static uint32_t const kSproutLogIndexVersion = 1;
+//Records are grouped into index entries of roughly this many bytes
+static size_t const kSproutLogIndexChunkSize = 64 * 1024;
+//Matching records are handed back in batches of (at most) this many records
+static NSUInteger const kSproutLogQueryBatchSize = 256;
+
+//The layout of the lines written by SproutCustomLogFormatter:
+//"yyyy-MM-dd HH:mm:ss:SSS         <thread> function(file line)"
+//"yyyy-MM-dd HH:mm:ss:SSS [LEVEL] message"
+static size_t const kTimestampLength = 23;
+static size_t const kTimestampHourLength = 13;
+static size_t const kHeaderThreadOffset = 32;
+static size_t const kLevelOffset = 24;
+static size_t const kLevelLength = 7;
+static size_t const kMessageOffset = 32;
+
+typedef struct
+{
+    char magic[8];
+    uint32_t version;
+    uint32_t entryCount;
+    uint64_t fileSize;
+    double modificationTime;
+} SproutLogIndexHeader;
+
+typedef struct
+{
+    uint64_t offset;
+    uint64_t length;
+    double minTime;
+    double maxTime;
+    uint32_t flags;
+    uint32_t reserved;
+} SproutLogIndexEntry;
+
+typedef struct
+{
+    NSMutableData *entries;
+    SproutLogIndexEntry current;
+    BOOL hasCurrent;
+} SproutLogIndexBuilder;
+
+typedef struct
+{
+    char key[13];
+    double hourStart;
+    BOOL valid;
+} SproutTimestampCache;
+
+typedef struct
+{
+    double time;
+    uint32_t flags;
+    const char *thread;
+    size_t threadLength;
+    const char *function;
+    size_t functionLength;
+    const char *file;
+    size_t fileLength;
+    NSUInteger line;
+    const char *message;
+    size_t messageLength;
+    const char *start;
+    const char *end;
+} SproutParsedRecord;
+
+typedef struct
+{
+    double startTime;
+    double endTime;
+    uint32_t flags;
+    BOOL hasContext;
+    const char *fileName;
+    size_t fileNameLength;
+    const char *function;
+    size_t functionLength;
+    const char *substring;
+    size_t substringLength;
+} SproutCompiledQuery;
+
+#pragma mark - Parsing
+
+static inline BOOL sproutIsDigit(char c)
+{
+    return c >= '0' && c <= '9';
+}
+
+static inline int sproutDigits(const char *p, size_t count)
+{
+    int retVal = 0;
+    for (size_t i = 0; i < count; ++i)
+    {
+        retVal = retVal * 10 + (p[i] - '0');
+    }
+    return retVal;
+}
+
+static BOOL sproutHasTimestamp(const char *p, size_t length)
+{
+    static const char shape[] = "dddd-dd-dd dd:dd:dd:ddd";
+
+    if (length < kTimestampLength)
+    {
+        return NO;
+    }
+
+    for (size_t i = 0; i < kTimestampLength; ++i)
+    {
+        if (shape[i] == 'd' ? !sproutIsDigit(p[i]) : p[i] != shape[i])
+        {
+            return NO;
+        }
+    }
+
+    return YES;
+}
+
+//Converts a local "yyyy-MM-dd HH:mm:ss:SSS" timestamp to seconds since 1970.
+//`mktime` is only consulted once per hour of log output, since DST transitions happen on hour boundaries.
+static double sproutTimestampTime(const char *p, SproutTimestampCache *cache)
+{
+    if (!cache->valid || memcmp(cache->key, p, kTimestampHourLength) != 0)
+    {
+        struct tm components;
+        memset(&components, 0, sizeof(components));
+        components.tm_year = sproutDigits(p, 4) - 1900;
+        components.tm_mon = sproutDigits(p + 5, 2) - 1;
+        components.tm_mday = sproutDigits(p + 8, 2);
+        components.tm_hour = sproutDigits(p + 11, 2);
+        components.tm_isdst = -1;
+
+        memcpy(cache->key, p, kTimestampHourLength);
+        cache->hourStart = (double)mktime(&components);
+        cache->valid = YES;
+    }
+
+    return cache->hourStart + sproutDigits(p + 14, 2) * 60 + sproutDigits(p + 17, 2) + sproutDigits(p + 20, 3) / 1000.0;
+}
+
+static inline BOOL sproutIsHeaderLine(const char *p, size_t length)
+{
+    //Check the cheap, distinctive bytes first, as this is called for every line of a message.
+    if (length <= kHeaderThreadOffset || p[kHeaderThreadOffset] != '<' || p[kTimestampLength] != ' ' || p[kHeaderThreadOffset - 1] != ' ')
+    {
+        return NO;
+    }
+
+    return sproutHasTimestamp(p, length);
+}
+
+static uint32_t sproutFlagsForLevel(const char *p)
+{
+    if (memcmp(p, "[ERROR]", kLevelLength) == 0)
+    {
+        return DDLogFlagError;
+    }
+    if (memcmp(p, " [WARN]", kLevelLength) == 0)
+    {
+        return DDLogFlagWarning;
+    }
+    if (memcmp(p, " [INFO]", kLevelLength) == 0)
+    {
+        return DDLogFlagInfo;
+    }
+    //SproutCustomLogFormatter writes both debug and verbose messages as "[DEBUG]"
+    return DDLogFlagDebug | DDLogFlagVerbose;
+}
+
+static void sproutParseHeaderLine(const char *line, size_t length, SproutParsedRecord *record)
+{
+    const char *end = line + length;
+    const char *thread = line + kHeaderThreadOffset + 1;
+    const char *threadEnd = memchr(thread, '>', (size_t)(end - thread));
+    if (!threadEnd)
+    {
+        threadEnd = end;
+    }
+    record->thread = thread;
+    record->threadLength = (size_t)(threadEnd - thread);
+
+    //The function may itself contain parentheses, so the location is found from the end of the line.
+    const char *function = MIN(threadEnd + 2, end);
+    const char *locationEnd = end;
+    while (locationEnd > function && locationEnd[-1] != ')')
+    {
+        --locationEnd;
+    }
+    const char *locationStart = locationEnd;
+    while (locationStart > function && locationStart[-1] != '(')
+    {
+        --locationStart;
+    }
+
+    record->function = function;
+    record->functionLength = locationStart > function ? (size_t)(locationStart - 1 - function) : (size_t)(end - function);
+    record->file = NULL;
+    record->fileLength = 0;
+    record->line = 0;
+
+    if (locationEnd > locationStart)
+    {
+        const char *lineNumber = locationEnd - 1;
+        while (lineNumber > locationStart && lineNumber[-1] != ' ')
+        {
+            --lineNumber;
+        }
+        record->file = locationStart;
+        record->fileLength = lineNumber > locationStart ? (size_t)(lineNumber - 1 - locationStart) : 0;
+        for (const char *p = lineNumber; p < locationEnd - 1 && sproutIsDigit(*p); ++p)
+        {
+            record->line = record->line * 10 + (NSUInteger)(*p - '0');
+        }
+    }
+}
+
+static inline const char *sproutLineEnd(const char *p, const char *end)
+{
+    const char *retVal = memchr(p, '\n', (size_t)(end - p));
+    return retVal ?: end;
+}
+
+//Calls `handler` for each record which starts within [begin, end).
+static void sproutEnumerateRecords(const char *begin, const char *end, SproutTimestampCache *cache, void (^handler)(SproutParsedRecord *record))
+{
+    const char *cursor = begin;
+
+    //Skip anything (i.e. a log file header) before the first record
+    while (cursor < end)
+    {
+        const char *lineEnd = sproutLineEnd(cursor, end);
+        if (sproutIsHeaderLine(cursor, (size_t)(lineEnd - cursor)))
+        {
+            break;
+        }
+        cursor = lineEnd + 1;
+    }
+
+    while (cursor < end)
+    {
+        SproutParsedRecord record;
+        memset(&record, 0, sizeof(record));
+        record.start = cursor;
+
+        const char *headerEnd = sproutLineEnd(cursor, end);
+        record.time = sproutTimestampTime(cursor, cache);
+        sproutParseHeaderLine(cursor, (size_t)(headerEnd - cursor), &record);
+
+        const char *p = headerEnd + 1;
+        record.flags = DDLogFlagDebug | DDLogFlagVerbose;
+        record.message = MIN(p, end);
+        if (p < end)
+        {
+            const char *messageLineEnd = sproutLineEnd(p, end);
+            size_t messageLineLength = (size_t)(messageLineEnd - p);
+            if (messageLineLength >= kMessageOffset && sproutHasTimestamp(p, messageLineLength))
+            {
+                record.flags = sproutFlagsForLevel(p + kLevelOffset);
+                record.message = p + kMessageOffset;
+            }
+            else if (sproutIsHeaderLine(p, messageLineLength))
+            {
+                //A record without a message line; leave `p` at the next record.
+                messageLineEnd = p - 1;
+            }
+            p = messageLineEnd + 1;
+        }
+
+        //Any following lines which don't start a new record are continuation lines of a multi-line message
+        while (p < end)
+        {
+            const char *lineEnd = sproutLineEnd(p, end);
+            if (sproutIsHeaderLine(p, (size_t)(lineEnd - p)))
+            {
+                break;
+            }
+            p = lineEnd + 1;
+        }
+
+        p = MIN(p, end);
+        record.end = p;
+        const char *messageEnd = (p > record.message && p[-1] == '\n') ? p - 1 : p;
+        record.messageLength = messageEnd > record.message ? (size_t)(messageEnd - record.message) : 0;
+
+        handler(&record);
+
+        cursor = p;
+    }
+}
+
+static BOOL sproutRangeContains(const char *haystack, size_t haystackLength, const char *needle, size_t needleLength)
+{
+    if (needleLength == 0)
+    {
+        return YES;
+    }
+    return haystack && memmem(haystack, haystackLength, needle, needleLength) != NULL;
+}
+
+static BOOL sproutRecordMatches(const SproutParsedRecord *record, const SproutCompiledQuery *query)
+{
+    if (record->time < query->startTime || record->time >= query->endTime)
+    {
+        return NO;
+    }
+
+    if (!(record->flags & query->flags))
+    {
+        return NO;
+    }
+
+    if (query->hasContext)
+    {
+        //The text format doesn't record the context
+        return NO;
+    }
+
+    if (query->fileName && (record->fileLength != query->fileNameLength || memcmp(record->file, query->fileName, query->fileNameLength) != 0))
+    {
+        return NO;
+    }
+
+    if (query->function && !sproutRangeContains(record->function, record->functionLength, query->function, query->functionLength))
+    {
+        return NO;
+    }
+
+    if (query->substring && !sproutRangeContains(record->message, record->messageLength, query->substring, query->substringLength))
+    {
+        return NO;
+    }
+
+    return YES;
+}
+
+static inline BOOL sproutIndexEntryMayMatch(const SproutLogIndexEntry *entry, const SproutCompiledQuery *query)
+{
+    return entry->maxTime >= query->startTime && entry->minTime < query->endTime && (entry->flags & query->flags);
+}
+
+static void sproutIndexBuilderFinishEntry(SproutLogIndexBuilder *builder)
+{
+    if (builder->hasCurrent)
+    {
+        [builder->entries appendBytes:&builder->current length:sizeof(builder->current)];
+        builder->hasCurrent = NO;
+    }
+}
+
+static void sproutIndexBuilderAddRecord(SproutLogIndexBuilder *builder, const SproutParsedRecord *record, const char *base)
+{
+    if (!builder->hasCurrent)
+    {
+        memset(&builder->current, 0, sizeof(builder->current));
+        builder->current.offset = (uint64_t)(record->start - base);
+        builder->current.minTime = record->time;
+        builder->current.maxTime = record->time;
+        builder->hasCurrent = YES;
+    }
+
+    SproutLogIndexEntry *entry = &builder->current;
+    entry->length = (uint64_t)(record->end - base) - entry->offset;
+    entry->minTime = MIN(entry->minTime, record->time);
+    entry->maxTime = MAX(entry->maxTime, record->time);
+    entry->flags |= record->flags;
+
+    if (entry->length >= kSproutLogIndexChunkSize)
+    {
+        sproutIndexBuilderFinishEntry(builder);
+    }
+}
+
+#pragma mark - SproutLogQuery
+
+@implementation SproutLogQuery
+
++ (instancetype)queryForFlags:(DDLogFlag)flags withinLast:(NSTimeInterval)interval
+{
+    SproutLogQuery *retVal = [[self alloc] init];
+    retVal.flags = flags;
+    retVal.startDate = [NSDate dateWithTimeIntervalSinceNow:-interval];
+    return retVal;
+}
+
+- (id)init
+{
+    if ((self = [super init]))
+    {
+        _flags = (DDLogFlag)DDLogLevelAll;
+    }
+
+    return self;
+}
+
+- (id)copyWithZone:(NSZone *)zone
+{
+    SproutLogQuery *retVal = [[[self class] allocWithZone:zone] init];
+    retVal.startDate = self.startDate;
+    retVal.endDate = self.endDate;
+    retVal.flags = self.flags;
+    retVal.context = self.context;
+    retVal.fileName = self.fileName;
+    retVal.function = self.function;
+    retVal.substring = self.substring;
+    return retVal;
+}
+
+@end
+
+#pragma mark - SproutLogRecord
+
+@implementation SproutLogRecord
+
+- (instancetype)initWithTimestamp:(NSDate *)timestamp flag:(DDLogFlag)flag context:(NSInteger)context threadID:(NSString *)threadID function:(NSString *)function fileName:(NSString *)fileName line:(NSUInteger)line message:(NSString *)message logFilePath:(NSString *)logFilePath
+{
+    if ((self = [super init]))
+    {
+        _timestamp = timestamp;
+        _flag = flag;
+        _context = context;
+        _threadID = [threadID copy];
+        _function = [function copy];
+        _fileName = [fileName copy];
+        _line = line;
+        _message = [message copy];
+        _logFilePath = [logFilePath copy];
+    }
+
+    return self;
+}
+
+- (NSString *)description
+{
+    return [NSString stringWithFormat:@"<%@: %p> %@ <%@> %@(%@ %lu) %@", NSStringFromClass(self.class), (void *)self, self.timestamp, self.threadID, self.function, self.fileName, (unsigned long)self.line, self.message];
+}
+
+@end
+
+#pragma mark - SproutLogQueryEngine
+
+@interface SproutLogQueryEngine ()
+
+@property (nonatomic, strong) dispatch_queue_t searchQueue;
+
+@end
+
+@implementation SproutLogQueryEngine
+
+- (instancetype)initWithLogFileManager:(id<DDLogFileManager>)logFileManager
+{
+    if ((self = [super init]))
+    {
+        _logFileManager = logFileManager;
+        _searchQueue = dispatch_queue_create("sprout.logquery", DISPATCH_QUEUE_CONCURRENT);
+    }
+
+    return self;
+}
+
+- (void)searchWithQuery:(SproutLogQuery *)query resultsQueue:(dispatch_queue_t)resultsQueue resultsHandler:(void(^)(NSArray<SproutLogRecord *> *records))resultsHandler completion:(void(^)(void))completion
+{
+    SproutLogQuery *theQuery = [query copy];
+    dispatch_queue_t callbackQueue = resultsQueue ?: dispatch_get_main_queue();
+
+    dispatch_async(self.searchQueue, ^{ @autoreleasepool {
+        NSArray<DDLogFileInfo *> *logFileInfos = [self.logFileManager sortedLogFileInfos];
+        [self pruneIndexesForLogFileInfos:logFileInfos];
+
+        dispatch_group_t group = dispatch_group_create();
+
+        for (DDLogFileInfo *logFileInfo in logFileInfos)
+        {
+            if (![self logFileInfo:logFileInfo mayMatchQuery:theQuery])
+            {
+                continue;
+            }
+
+            dispatch_group_async(group, self.searchQueue, ^{ @autoreleasepool {
+                [self searchLogFileInfo:logFileInfo query:theQuery resultsHandler:^(NSArray<SproutLogRecord *> *records) {
+                    //Deliveries are part of the group too, so `completion` is always called last.
+                    dispatch_group_async(group, callbackQueue, ^{
+                        resultsHandler(records);
+                    });
+                }];
+            } });
+        }
+
+        dispatch_group_notify(group, callbackQueue, ^{
+            if (completion)
+            {
+                completion();
+            }
+        });
+    } });
+}
+
+#pragma mark Helpers
+
+- (BOOL)logFileInfo:(DDLogFileInfo *)logFileInfo mayMatchQuery:(SproutLogQuery *)query
+{
+    //A file created after the end of the query range can't contain earlier records
+    if (query.endDate && [logFileInfo.creationDate compare:query.endDate] == NSOrderedDescending)
+    {
+        return NO;
+    }
+
+    //A file last written before the start of the query range can't contain later records
+    if (query.startDate && [logFileInfo.modificationDate compare:query.startDate] == NSOrderedAscending)
+    {
+        return NO;
+    }
+
+    return YES;
+}
+
+- (void)searchLogFileInfo:(DDLogFileInfo *)logFileInfo query:(SproutLogQuery *)query resultsHandler:(void(^)(NSArray<SproutLogRecord *> *records))resultsHandler
+{
+    NSString *filePath = logFileInfo.filePath;
+    NSData *data = nil;
+    if ([filePath.pathExtension isEqualToString:SproutCompressedLogFileExtension])
+    {
+        data = [SproutCompressedLogDecoder decodeFileAtPath:filePath error:nil];
+    }
+    else
+    {
+        data = [NSData dataWithContentsOfFile:filePath options:NSDataReadingMappedAlways error:nil];
+    }
+    if (data.length == 0)
+    {
+        //The file may have been deleted since it was listed
+        return;
+    }
+
+    SproutCompiledQuery compiledQuery;
+    memset(&compiledQuery, 0, sizeof(compiledQuery));
+    compiledQuery.startTime = query.startDate ? query.startDate.timeIntervalSince1970 : -DBL_MAX;
+    compiledQuery.endTime = query.endDate ? query.endDate.timeIntervalSince1970 : DBL_MAX;
+    compiledQuery.flags = (uint32_t)query.flags;
+    compiledQuery.hasContext = query.context != nil;
+    //The UTF8 buffers live as long as the (copied) query strings, which outlive this method.
+    if (query.fileName)
+    {
+        compiledQuery.fileName = query.fileName.UTF8String;
+        compiledQuery.fileNameLength = strlen(compiledQuery.fileName);
+    }
+    if (query.function)
+    {
+        compiledQuery.function = query.function.UTF8String;
+        compiledQuery.functionLength = strlen(compiledQuery.function);
+    }
+    if (query.substring)
+    {
+        compiledQuery.substring = query.substring.UTF8String;
+        compiledQuery.substringLength = strlen(compiledQuery.substring);
+    }
+
+    const char *base = data.bytes;
+    const char *end = base + data.length;
+    __block SproutTimestampCache cache;
+    memset(&cache, 0, sizeof(cache));
+    __block NSMutableArray<SproutLogRecord *> *batch = [NSMutableArray arrayWithCapacity:kSproutLogQueryBatchSize];
+
+    void (^collect)(SproutParsedRecord *) = ^(SproutParsedRecord *record) {
+        if (!sproutRecordMatches(record, &compiledQuery))
+        {
+            return;
+        }
+
+        [batch addObject:[self recordForParsedRecord:record logFilePath:filePath]];
+        if (batch.count >= kSproutLogQueryBatchSize)
+        {
+            resultsHandler(batch);
+            batch = [NSMutableArray arrayWithCapacity:kSproutLogQueryBatchSize];
+        }
+    };
+
+    //Archived log files never change, so they can be indexed.
+    BOOL isArchived = logFileInfo.isArchived;
+    NSData *indexData = isArchived ? [self indexDataForLogFileInfo:logFileInfo] : nil;
+
+    if (indexData)
+    {
+        const SproutLogIndexHeader *header = indexData.bytes;
+        const SproutLogIndexEntry *entries = (const SproutLogIndexEntry *)(header + 1);
+        for (uint32_t i = 0; i < header->entryCount; ++i)
+        {
+            const SproutLogIndexEntry *entry = &entries[i];
+            if (sproutIndexEntryMayMatch(entry, &compiledQuery) && entry->offset + entry->length <= data.length)
+            {
+                sproutEnumerateRecords(base + entry->offset, base + entry->offset + entry->length, &cache, collect);
+            }
+        }
+    }
+    else if (isArchived)
+    {
+        //No index yet, so search the whole file and build one along the way.
+        __block SproutLogIndexBuilder builder;
+        memset(&builder, 0, sizeof(builder));
+        builder.entries = [NSMutableData data];
+
+        sproutEnumerateRecords(base, end, &cache, ^(SproutParsedRecord *record) {
+            sproutIndexBuilderAddRecord(&builder, record, base);
+            collect(record);
+        });
+        sproutIndexBuilderFinishEntry(&builder);
+
+        [self writeIndexEntries:builder.entries forLogFileInfo:logFileInfo];
+    }
+    else
+    {
+        sproutEnumerateRecords(base, end, &cache, collect);
+    }
+
+    if (batch.count > 0)
+    {
+        resultsHandler(batch);
+    }
+}
+
+- (SproutLogRecord *)recordForParsedRecord:(const SproutParsedRecord *)record logFilePath:(NSString *)logFilePath
+{
+    NSString *threadID = [[NSString alloc] initWithBytes:record->thread length:record->threadLength encoding:NSUTF8StringEncoding];
+    NSString *function = [[NSString alloc] initWithBytes:record->function length:record->functionLength encoding:NSUTF8StringEncoding];
+    NSString *fileName = record->file ? [[NSString alloc] initWithBytes:record->file length:record->fileLength encoding:NSUTF8StringEncoding] : nil;
+    NSString *message = [[NSString alloc] initWithBytes:record->message length:record->messageLength encoding:NSUTF8StringEncoding];
+    DDLogFlag flag = (record->flags & DDLogFlagDebug) ? DDLogFlagDebug : (DDLogFlag)record->flags;
+
+    return [[SproutLogRecord alloc] initWithTimestamp:[NSDate dateWithTimeIntervalSince1970:record->time] flag:flag context:NSNotFound threadID:threadID ?: @"" function:function ?: @"" fileName:fileName ?: @"" line:record->line message:message ?: @"" logFilePath:logFilePath];
+}
+
+#pragma mark Index
+
+- (NSString *)indexDirectory
+{
+    return [self.logFileManager.logsDirectory stringByAppendingPathComponent:kSproutLogIndexDirectoryName];
+}
+
+- (NSString *)indexPathForLogFileInfo:(DDLogFileInfo *)logFileInfo
+{
+    return [[[self indexDirectory] stringByAppendingPathComponent:logFileInfo.fileName] stringByAppendingPathExtension:kSproutLogIndexFileExtension];
+}
+
+- (NSData *)indexDataForLogFileInfo:(DDLogFileInfo *)logFileInfo
+{
+    NSData *retVal = [NSData dataWithContentsOfFile:[self indexPathForLogFileInfo:logFileInfo] options:NSDataReadingMappedIfSafe error:nil];
+    if (retVal.length < sizeof(SproutLogIndexHeader))
+    {
+        return nil;
+    }
+
+    const SproutLogIndexHeader *header = retVal.bytes;
+    BOOL valid = memcmp(header->magic, kSproutLogIndexMagic, sizeof(kSproutLogIndexMagic)) == 0
+        && header->version == kSproutLogIndexVersion
+        && retVal.length == sizeof(SproutLogIndexHeader) + header->entryCount * sizeof(SproutLogIndexEntry)
+        && header->fileSize == logFileInfo.fileSize
+        && header->modificationTime == logFileInfo.modificationDate.timeIntervalSinceReferenceDate;
+
+    return valid ? retVal : nil;
+}
+
+- (void)writeIndexEntries:(NSData *)entries forLogFileInfo:(DDLogFileInfo *)logFileInfo
+{
+    SproutLogIndexHeader header;
+    memset(&header, 0, sizeof(header));
+    memcpy(header.magic, kSproutLogIndexMagic, sizeof(kSproutLogIndexMagic));
+    header.version = kSproutLogIndexVersion;
+    header.entryCount = (uint32_t)(entries.length / sizeof(SproutLogIndexEntry));
+    header.fileSize = logFileInfo.fileSize;
+    header.modificationTime = logFileInfo.modificationDate.timeIntervalSinceReferenceDate;
+
+    NSMutableData *indexData = [NSMutableData dataWithBytes:&header length:sizeof(header)];
+    [indexData appendData:entries];
+
+    [[NSFileManager defaultManager] createDirectoryAtPath:[self indexDirectory] withIntermediateDirectories:YES attributes:nil error:nil];
+    [indexData writeToFile:[self indexPathForLogFileInfo:logFileInfo] atomically:YES];
+}
+
+//Removes the indexes of log files which have since been deleted
+- (void)pruneIndexesForLogFileInfos:(NSArray<DDLogFileInfo *> *)logFileInfos
+{
+    NSString *indexDirectory = [self indexDirectory];
+    NSArray<NSString *> *indexFileNames = [[NSFileManager defaultManager] contentsOfDirectoryAtPath:indexDirectory error:nil];
+    if (indexFileNames.count == 0)
+    {
+        return;
+    }
+
+    NSMutableSet<NSString *> *logFileNames = [NSMutableSet setWithCapacity:logFileInfos.count];
+    for (DDLogFileInfo *logFileInfo in logFileInfos)
+    {
+        [logFileNames addObject:logFileInfo.fileName];
+    }
+
+    for (NSString *indexFileName in indexFileNames)
+    {
+        if (![logFileNames containsObject:[indexFileName stringByDeletingPathExtension]])
+        {
+            [[NSFileManager defaultManager] removeItemAtPath:[indexDirectory stringByAppendingPathComponent:indexFileName] error:nil];
+        }
+    }
+}
+
+@end
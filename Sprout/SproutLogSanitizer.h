@@ -0,0 +1,85 @@
+//
+//  SproutLogSanitizer.h
+//
+//  Part of "Sprout" https://github.com/levigroker/Sprout
+//
+//  Created on October 19, 2026.
+//  Copyright (c) 2026 Levi Brown <mailto:levigroker@gmail.com> This work is
+//  licensed under the Creative Commons Attribution 4.0 International License. To
+//  view a copy of this license, visit https://creativecommons.org/licenses/by/4.0/
+//  or send a letter to Creative Commons, PO Box 1866, Mountain View, CA 94042, USA.
+//
+//  The above attribution and the included license must accompany any version of
+//  the source code, binary distributable, or derivatives.
+//
+
+#import <Foundation/Foundation.h>
+
+#import "SproutLogBuffer.h"
+
+typedef NS_ENUM(NSUInteger, SproutLogSanitizerMode)
+{
+    /**
+     Line breaks and other control characters are escaped (i.e. `\n`, `\r` and `\x1b`), so every message is one line.
+     Backslashes are escaped as `\\`, so a message can't forge an escaped line break (or a log entry after one).
+     */
+    SproutLogSanitizerModeEscape,
+    /**
+     Each line after the first is prefixed with the `indent`, so continuation lines can be told apart from new log entries.
+     Trailing line breaks are removed, and other control characters are escaped. Backslashes are left as is, so the escapes
+     are for reading rather than parsing.
+     */
+    SproutLogSanitizerModeIndent,
+};
+
+/**
+ @return The offset of the first byte in the given UTF-8 bytes which a sanitizer using the given mode would change (a
+ control character other than tab, or a backslash when escaping), or `length` if there is none.
+ The bytes are scanned 16 at a time, with NEON or SSE2 where available.
+ */
+extern size_t SproutLogSanitizerScan(const uint8_t *bytes, size_t length, SproutLogSanitizerMode mode);
+
+/**
+ Removes line breaks and control characters from log messages, for the benefit of line based log tooling.
+ Sanitizing is a shared stage for log formatters (see the `messageSanitizer` of `SproutCustomLogFormatter` and
+ `SproutTemplateLogFormatter`).
+
+ Most messages contain nothing to sanitize, and are returned (or appended) as is after a single vectorized scan.
+ Sanitizers are immutable, and can be shared between formatters and threads.
+ */
+@interface SproutLogSanitizer : NSObject
+
+@property (nonatomic, assign, readonly) SproutLogSanitizerMode mode;
+@property (nonatomic, copy, readonly) NSString *indent;
+
+/**
+ @return A sanitizer using `SproutLogSanitizerModeEscape`.
+ */
++ (instancetype)escapingSanitizer;
+
+/**
+ @return A sanitizer using `SproutLogSanitizerModeIndent`, indenting continuation lines with four spaces.
+ */
++ (instancetype)indentingSanitizer;
+
+/**
+ @param mode How line breaks are sanitized.
+ @param indent The prefix for continuation lines, for `SproutLogSanitizerModeIndent`. Ignored for other modes.
+ */
+- (instancetype)initWithMode:(SproutLogSanitizerMode)mode indent:(NSString *)indent;
+
+/**
+ @param string The string to sanitize.
+ @return The sanitized string. If there was nothing to sanitize this is the given string.
+ */
+- (NSString *)sanitizeString:(NSString *)string;
+
+/**
+ Appends the sanitized string to the given buffer.
+
+ @param string The string to sanitize.
+ @param buffer The buffer to append to.
+ */
+- (void)appendString:(NSString *)string toBuffer:(SproutLogBuffer *)buffer;
+
+@end
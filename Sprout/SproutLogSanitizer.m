@@ -0,0 +1,231 @@
+//
+//  SproutLogSanitizer.m
+//
+//  Part of "Sprout" https://github.com/levigroker/Sprout
+//
+//  Created on October 19, 2026.
+//  Copyright (c) 2026 Levi Brown <mailto:levigroker@gmail.com> This work is
+//  licensed under the Creative Commons Attribution 4.0 International License. To
+//  view a copy of this license, visit https://creativecommons.org/licenses/by/4.0/
+//  or send a letter to Creative Commons, PO Box 1866, Mountain View, CA 94042, USA.
+//
+//  The above attribution and the included license must accompany any version of
+//  the source code, binary distributable, or derivatives.
+//
+
+#if defined(__ARM_NEON) && defined(__aarch64__)
+#include <arm_neon.h>
+#define SPROUT_SANITIZER_NEON 1
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#define SPROUT_SANITIZER_SSE2 1
+#endif
+
+#import "SproutLogSanitizer.h"
+
+static inline BOOL sproutNeedsSanitizing(uint8_t byte, uint8_t escapeCharacter)
+{
+    return (byte < 0x20 && byte != '\t') || byte == 0x7F || byte == escapeCharacter;
+}
+
+size_t SproutLogSanitizerScan(const uint8_t *bytes, size_t length, SproutLogSanitizerMode mode)
+{
+    size_t i = 0;
+    //Escaping also escapes the escape character itself. Other modes leave it alone, which is done by matching delete again
+    const uint8_t escapeCharacter = mode == SproutLogSanitizerModeEscape ? '\\' : 0x7F;
+
+#if SPROUT_SANITIZER_NEON
+    const uint8x16_t space = vdupq_n_u8(0x20);
+    const uint8x16_t tab = vdupq_n_u8('\t');
+    const uint8x16_t deleteCharacter = vdupq_n_u8(0x7F);
+    const uint8x16_t escape = vdupq_n_u8(escapeCharacter);
+    for (; i + 16 <= length; i += 16)
+    {
+        uint8x16_t chunk = vld1q_u8(bytes + i);
+        uint8x16_t control = vbicq_u8(vcltq_u8(chunk, space), vceqq_u8(chunk, tab));
+        uint8x16_t matches = vorrq_u8(control, vorrq_u8(vceqq_u8(chunk, deleteCharacter), vceqq_u8(chunk, escape)));
+        if (vmaxvq_u8(matches))
+        {
+            //Narrow each byte of the mask to four bits, and find the first one set
+            uint64_t mask = vget_lane_u64(vreinterpret_u64_u8(vshrn_n_u16(vreinterpretq_u16_u8(matches), 4)), 0);
+            return i + (size_t)(__builtin_ctzll(mask) >> 2);
+        }
+    }
+#elif SPROUT_SANITIZER_SSE2
+    const __m128i maximumControl = _mm_set1_epi8(0x1F);
+    const __m128i tab = _mm_set1_epi8('\t');
+    const __m128i deleteCharacter = _mm_set1_epi8(0x7F);
+    const __m128i escape = _mm_set1_epi8((char)escapeCharacter);
+    for (; i + 16 <= length; i += 16)
+    {
+        __m128i chunk = _mm_loadu_si128((const __m128i *)(bytes + i));
+        //Unsigned `chunk <= 0x1F`, as SSE2 only has signed byte comparisons
+        __m128i control = _mm_cmpeq_epi8(_mm_max_epu8(chunk, maximumControl), maximumControl);
+        control = _mm_andnot_si128(_mm_cmpeq_epi8(chunk, tab), control);
+        __m128i matches = _mm_or_si128(control, _mm_or_si128(_mm_cmpeq_epi8(chunk, deleteCharacter), _mm_cmpeq_epi8(chunk, escape)));
+        int mask = _mm_movemask_epi8(matches);
+        if (mask)
+        {
+            return i + (size_t)__builtin_ctz((unsigned int)mask);
+        }
+    }
+#endif
+
+    for (; i < length; ++i)
+    {
+        if (sproutNeedsSanitizing(bytes[i], escapeCharacter))
+        {
+            return i;
+        }
+    }
+
+    return length;
+}
+
+@interface SproutLogSanitizer ()
+{
+    NSData *_indentData;
+}
+
+@end
+
+@implementation SproutLogSanitizer
+
++ (instancetype)escapingSanitizer
+{
+    return [[self alloc] initWithMode:SproutLogSanitizerModeEscape indent:nil];
+}
+
++ (instancetype)indentingSanitizer
+{
+    return [[self alloc] initWithMode:SproutLogSanitizerModeIndent indent:@"    "];
+}
+
+- (instancetype)init
+{
+    return [self initWithMode:SproutLogSanitizerModeEscape indent:nil];
+}
+
+- (instancetype)initWithMode:(SproutLogSanitizerMode)mode indent:(NSString *)indent
+{
+    if ((self = [super init]))
+    {
+        _mode = mode;
+        _indent = [indent copy] ?: @"";
+        _indentData = [_indent dataUsingEncoding:NSUTF8StringEncoding];
+    }
+
+    return self;
+}
+
+- (NSString *)sanitizeString:(NSString *)string
+{
+    __block NSString *retVal = string;
+
+    SproutLogBufferWithUTF8(string, ^(const uint8_t *bytes, size_t length) {
+        size_t offset = SproutLogSanitizerScan(bytes, length, self.mode);
+        if (offset < length)
+        {
+            SproutLogBuffer buffer;
+            SproutLogBufferInit(&buffer);
+            SproutLogBufferAppendBytes(&buffer, bytes, offset);
+            [self sanitizeBytes:bytes + offset length:length - offset toBuffer:&buffer];
+            retVal = SproutLogBufferCopyString(&buffer);
+        }
+    });
+
+    return retVal;
+}
+
+- (void)appendString:(NSString *)string toBuffer:(SproutLogBuffer *)buffer
+{
+    SproutLogBufferWithUTF8(string, ^(const uint8_t *bytes, size_t length) {
+        size_t offset = SproutLogSanitizerScan(bytes, length, self.mode);
+        SproutLogBufferAppendBytes(buffer, bytes, offset);
+        if (offset < length)
+        {
+            [self sanitizeBytes:bytes + offset length:length - offset toBuffer:buffer];
+        }
+    });
+}
+
+#pragma mark NSObject
+
+- (BOOL)isEqual:(id)object
+{
+    if (![object isKindOfClass:[SproutLogSanitizer class]])
+    {
+        return NO;
+    }
+
+    SproutLogSanitizer *other = object;
+    return self.mode == other.mode && (self.mode != SproutLogSanitizerModeIndent || [self.indent isEqualToString:other.indent]);
+}
+
+- (NSUInteger)hash
+{
+    return self.mode ^ (self.mode == SproutLogSanitizerModeIndent ? self.indent.hash : 0);
+}
+
+#pragma mark Helpers
+
+//`bytes` starts with a byte which needs sanitizing
+- (void)sanitizeBytes:(const uint8_t *)bytes length:(size_t)length toBuffer:(SproutLogBuffer *)buffer
+{
+    static char const hexDigits[] = "0123456789abcdef";
+    BOOL indenting = self.mode == SproutLogSanitizerModeIndent;
+
+    size_t i = 0;
+    while (i < length)
+    {
+        uint8_t byte = bytes[i++];
+        BOOL lineBreak = byte == '\n' || byte == '\r';
+
+        if (lineBreak && indenting)
+        {
+            //Treat "\r\n" as a single line break
+            if (byte == '\r' && i < length && bytes[i] == '\n')
+            {
+                ++i;
+            }
+
+            //Drop trailing line breaks, rather than leaving an empty (indented) line
+            size_t remaining = i;
+            while (remaining < length && (bytes[remaining] == '\n' || bytes[remaining] == '\r'))
+            {
+                ++remaining;
+            }
+            if (remaining == length)
+            {
+                return;
+            }
+
+            SproutLogBufferAppendByte(buffer, '\n');
+            SproutLogBufferAppendBytes(buffer, _indentData.bytes, _indentData.length);
+        }
+        else if (byte == '\n')
+        {
+            SproutLogBufferAppendBytes(buffer, "\\n", 2);
+        }
+        else if (byte == '\r')
+        {
+            SproutLogBufferAppendBytes(buffer, "\\r", 2);
+        }
+        else if (byte == '\\')
+        {
+            SproutLogBufferAppendBytes(buffer, "\\\\", 2);
+        }
+        else
+        {
+            char escape[4] = { '\\', 'x', hexDigits[byte >> 4], hexDigits[byte & 0xF] };
+            SproutLogBufferAppendBytes(buffer, escape, sizeof(escape));
+        }
+
+        //Copy the following run of bytes which need no sanitizing in one go
+        size_t run = SproutLogSanitizerScan(bytes + i, length - i, self.mode);
+        SproutLogBufferAppendBytes(buffer, bytes + i, run);
+        i += run;
+    }
+}
+
+@end
@@ -0,0 +1,108 @@
+//
+//  SproutRedactor.h
+//
+//  Part of "Sprout" https://github.com/levigroker/Sprout
+//
+//  Created on October 19, 2026.
+//  Copyright (c) 2026 Levi Brown <mailto:levigroker@gmail.com> This work is
+//  licensed under the Creative Commons Attribution 4.0 International License. To
+//  view a copy of this license, visit https://creativecommons.org/licenses/by/4.0/
+//  or send a letter to Creative Commons, PO Box 1866, Mountain View, CA 94042, USA.
+//
+//  The above attribution and the included license must accompany any version of
+//  the source code, binary distributable, or derivatives.
+//
+
+#import <Foundation/Foundation.h>
+
+#import "SproutStagedLogFormatter.h"
+
+/**
+ Something a `SproutRedactor` removes from log messages.
+ */
+@interface SproutRedactionPattern : NSObject
+
+/**
+ The name hits are counted under (see `hitCounts`).
+ */
+@property (nonatomic, copy, readonly) NSString *name;
+
+/**
+ Redacts every occurrence of the given text (i.e. a known API key).
+
+ @param literal The text to redact. Matched without regard to ASCII case.
+ @param name The name hits are counted under.
+ */
++ (instancetype)literal:(NSString *)literal name:(NSString *)name;
+
+/**
+ Redacts the value following the given prefix (i.e. `@"Bearer "` or `@"password="`), up to the next white space, quote,
+ or separator (`,;&<>()[]{}`). The prefix itself is kept, so the log still shows what was redacted.
+
+ @param prefix The prefix. Matched without regard to ASCII case.
+ @param name The name hits are counted under.
+ */
++ (instancetype)prefix:(NSString *)prefix name:(NSString *)name;
+
+/**
+ Redacts email addresses.
+ */
++ (instancetype)emailAddress;
+
+/**
+ Redacts payment card numbers: runs of 13 to 19 digits (optionally grouped with single spaces or dashes), starting with a
+ 2 to 6 (the major industry identifiers of payment cards), which pass the Luhn check.
+ Other numbers of that form are redacted too: about one in ten 13 to 19 digit identifiers starting with a 2 to 6 passes
+ the Luhn check by chance. Log such identifiers with a non-digit prefix (i.e. `id=A1234...`) or in hexadecimal if they
+ need to survive redaction.
+ */
++ (instancetype)cardNumber;
+
+/**
+ Redacts matches of the given regular expression.
+ Regular expressions are comparatively slow, so each has an anchor: text which every match contains. The regular
+ expression is only evaluated for messages containing the anchor.
+
+ @param regularExpression The regular expression.
+ @param anchor Text which every match of the regular expression contains. Matched without regard to ASCII case.
+ @param name The name hits are counted under.
+ */
++ (instancetype)regularExpression:(NSRegularExpression *)regularExpression anchor:(NSString *)anchor name:(NSString *)name;
+
+@end
+
+/**
+ A log stage which redacts personal and secret information (email addresses, tokens, account numbers etc.) from log
+ messages before they are written anywhere.
+
+ All the literal text of the patterns (literals, prefixes and the anchors of regular expressions and email addresses) is
+ compiled into a single Aho-Corasick automaton, so each message is scanned once, a byte at a time, whatever the number of
+ patterns. Card numbers are found during the same scan. Regular expressions are only evaluated when their anchor is found.
+
+ Install it with `Sprout`'s `redactor` property (or a `SproutStagedLogFormatter`), so each message is redacted once
+ however many loggers it is written to.
+ */
+@interface SproutRedactor : NSObject <SproutLogStage>
+
+@property (nonatomic, copy, readonly) NSArray<SproutRedactionPattern *> *patterns;
+
+/**
+ The text redacted values are replaced with. Defaults to `<redacted>`.
+ */
+@property (nonatomic, copy, readonly) NSString *replacement;
+
+- (instancetype)initWithPatterns:(NSArray<SproutRedactionPattern *> *)patterns;
+- (instancetype)initWithPatterns:(NSArray<SproutRedactionPattern *> *)patterns replacement:(NSString *)replacement NS_DESIGNATED_INITIALIZER;
+
+/**
+ @param string The text to redact.
+ @return The redacted text. If there was nothing to redact this is the given string.
+ */
+- (NSString *)redactString:(NSString *)string;
+
+/**
+ @return The number of values redacted so far, by pattern name.
+ */
+- (NSDictionary<NSString *, NSNumber *> *)hitCounts;
+
+@end
@@ -0,0 +1,696 @@
+//
+//  SproutRedactor.m
+//
+//  Part of "Sprout" https://github.com/levigroker/Sprout
+//
+//  Created on October 19, 2026.
+//  Copyright (c) 2026 Levi Brown <mailto:levigroker@gmail.com> This work is
+//  licensed under the Creative Commons Attribution 4.0 International License. To
+//  view a copy of this license, visit https://creativecommons.org/licenses/by/4.0/
+//  or send a letter to Creative Commons, PO Box 1866, Mountain View, CA 94042, USA.
+//
+//  The above attribution and the included license must accompany any version of
+//  the source code, binary distributable, or derivatives.
+//
+
+#include <stdatomic.h>
+#include <stdlib.h>
+#include <string.h>
+
+#import "SproutRedactor.h"
+#import "SproutLogBuffer.h"
+
+typedef NS_ENUM(NSUInteger, SproutRedactionKind)
+{
+    SproutRedactionKindLiteral,
+    SproutRedactionKindPrefix,
+    SproutRedactionKindEmailAddress,
+    SproutRedactionKindCardNumber,
+    SproutRedactionKindRegularExpression,
+};
+
+#pragma mark - Automaton
+
+#define SPROUT_AUTOMATON_NONE UINT32_MAX
+
+/**
+ An Aho-Corasick automaton over bytes, with the failure transitions folded into a complete transition table (so scanning
+ is one table lookup per byte). ASCII letters are matched without regard to case.
+ */
+typedef struct
+{
+    uint32_t *transitions;      //`stateCount` rows of 256
+    uint32_t *firstKeyword;     //Per state, the first keyword ending at the state, or NONE
+    uint32_t *outputLink;       //Per state, the nearest state (along the failure links) at which a keyword ends, or NONE
+    uint32_t stateCount;
+
+    uint32_t *keywordPattern;   //Per keyword, the index of its pattern
+    uint32_t *keywordLength;
+    uint32_t *nextKeyword;      //Per keyword, the next keyword ending at the same state, or NONE
+    uint32_t keywordCount;
+} SproutAutomaton;
+
+typedef struct
+{
+    const uint8_t *bytes;
+    uint32_t length;
+    uint32_t pattern;
+} SproutKeyword;
+
+static inline uint8_t sproutLowercase(uint8_t byte)
+{
+    return (byte >= 'A' && byte <= 'Z') ? (uint8_t)(byte + ('a' - 'A')) : byte;
+}
+
+static void sproutAutomatonBuild(SproutAutomaton *automaton, const SproutKeyword *keywords, uint32_t keywordCount)
+{
+    uint32_t maximumStates = 1;
+    for (uint32_t k = 0; k < keywordCount; ++k)
+    {
+        maximumStates += keywords[k].length;
+    }
+
+    uint32_t *transitions = malloc((size_t)maximumStates * 256 * sizeof(uint32_t));
+    memset(transitions, 0xFF, (size_t)maximumStates * 256 * sizeof(uint32_t));
+    uint32_t *firstKeyword = malloc(maximumStates * sizeof(uint32_t));
+    uint32_t *outputLink = malloc(maximumStates * sizeof(uint32_t));
+    uint32_t *failure = calloc(maximumStates, sizeof(uint32_t));
+    for (uint32_t s = 0; s < maximumStates; ++s)
+    {
+        firstKeyword[s] = SPROUT_AUTOMATON_NONE;
+        outputLink[s] = SPROUT_AUTOMATON_NONE;
+    }
+
+    automaton->keywordPattern = malloc(MAX(keywordCount, 1) * sizeof(uint32_t));
+    automaton->keywordLength = malloc(MAX(keywordCount, 1) * sizeof(uint32_t));
+    automaton->nextKeyword = malloc(MAX(keywordCount, 1) * sizeof(uint32_t));
+    automaton->keywordCount = keywordCount;
+
+    //The trie
+    uint32_t stateCount = 1;
+    for (uint32_t k = 0; k < keywordCount; ++k)
+    {
+        uint32_t state = 0;
+        for (uint32_t i = 0; i < keywords[k].length; ++i)
+        {
+            uint8_t byte = sproutLowercase(keywords[k].bytes[i]);
+            uint32_t *next = &transitions[(size_t)state * 256 + byte];
+            if (*next == SPROUT_AUTOMATON_NONE)
+            {
+                *next = stateCount++;
+            }
+            state = *next;
+        }
+
+        automaton->keywordPattern[k] = keywords[k].pattern;
+        automaton->keywordLength[k] = keywords[k].length;
+        automaton->nextKeyword[k] = firstKeyword[state];
+        firstKeyword[state] = k;
+    }
+
+    //Breadth first, fill in the failure transitions
+    uint32_t *queue = malloc(stateCount * sizeof(uint32_t));
+    uint32_t head = 0;
+    uint32_t tail = 0;
+    for (uint32_t c = 0; c < 256; ++c)
+    {
+        uint32_t *next = &transitions[c];
+        if (*next == SPROUT_AUTOMATON_NONE)
+        {
+            *next = 0;
+        }
+        else
+        {
+            failure[*next] = 0;
+            queue[tail++] = *next;
+        }
+    }
+
+    while (head < tail)
+    {
+        uint32_t state = queue[head++];
+        uint32_t fallback = failure[state];
+        outputLink[state] = firstKeyword[fallback] != SPROUT_AUTOMATON_NONE ? fallback : outputLink[fallback];
+
+        for (uint32_t c = 0; c < 256; ++c)
+        {
+            uint32_t *next = &transitions[(size_t)state * 256 + c];
+            if (*next == SPROUT_AUTOMATON_NONE)
+            {
+                *next = transitions[(size_t)fallback * 256 + c];
+            }
+            else
+            {
+                failure[*next] = transitions[(size_t)fallback * 256 + c];
+                queue[tail++] = *next;
+            }
+        }
+    }
+
+    //Uppercase letters go wherever their lowercase counterparts do
+    for (uint32_t state = 0; state < stateCount; ++state)
+    {
+        uint32_t *row = &transitions[(size_t)state * 256];
+        for (uint32_t c = 'A'; c <= 'Z'; ++c)
+        {
+            row[c] = row[c + ('a' - 'A')];
+        }
+    }
+
+    free(queue);
+    free(failure);
+
+    automaton->transitions = transitions;
+    automaton->firstKeyword = firstKeyword;
+    automaton->outputLink = outputLink;
+    automaton->stateCount = stateCount;
+}
+
+static void sproutAutomatonFree(SproutAutomaton *automaton)
+{
+    free(automaton->transitions);
+    free(automaton->firstKeyword);
+    free(automaton->outputLink);
+    free(automaton->keywordPattern);
+    free(automaton->keywordLength);
+    free(automaton->nextKeyword);
+    memset(automaton, 0, sizeof(*automaton));
+}
+
+#pragma mark - Matching
+
+typedef struct
+{
+    size_t start;
+    size_t end;
+    uint32_t pattern;
+} SproutRedaction;
+
+typedef struct
+{
+    SproutRedaction *items;
+    size_t count;
+    size_t capacity;
+    SproutRedaction stack[16];
+} SproutRedactions;
+
+static void sproutRedactionsAdd(SproutRedactions *redactions, size_t start, size_t end, uint32_t pattern)
+{
+    if (redactions->count == redactions->capacity)
+    {
+        size_t capacity = redactions->capacity * 2;
+        if (redactions->items == redactions->stack)
+        {
+            redactions->items = malloc(capacity * sizeof(SproutRedaction));
+            memcpy(redactions->items, redactions->stack, sizeof(redactions->stack));
+        }
+        else
+        {
+            redactions->items = realloc(redactions->items, capacity * sizeof(SproutRedaction));
+        }
+        redactions->capacity = capacity;
+    }
+
+    redactions->items[redactions->count++] = (SproutRedaction){ start, end, pattern };
+}
+
+static inline BOOL sproutIsDigit(uint8_t byte)
+{
+    return byte >= '0' && byte <= '9';
+}
+
+static inline BOOL sproutIsAlphanumeric(uint8_t byte)
+{
+    uint8_t lowercase = sproutLowercase(byte);
+    return sproutIsDigit(byte) || (lowercase >= 'a' && lowercase <= 'z');
+}
+
+//Ends the value following a prefix
+static inline BOOL sproutIsValueDelimiter(uint8_t byte)
+{
+    return byte <= ' ' || strchr("\"',;&<>()[]{}", byte) != NULL;
+}
+
+static inline BOOL sproutIsEmailLocalCharacter(uint8_t byte)
+{
+    return sproutIsAlphanumeric(byte) || byte == '.' || byte == '_' || byte == '%' || byte == '+' || byte == '-';
+}
+
+static inline BOOL sproutIsEmailDomainCharacter(uint8_t byte)
+{
+    return sproutIsAlphanumeric(byte) || byte == '.' || byte == '-';
+}
+
+//Finds the email address around the '@' at `at`
+static BOOL sproutEmailAddressRange(const uint8_t *bytes, size_t length, size_t at, size_t *start, size_t *end)
+{
+    size_t localStart = at;
+    while (localStart > 0 && sproutIsEmailLocalCharacter(bytes[localStart - 1]))
+    {
+        --localStart;
+    }
+    while (localStart < at && bytes[localStart] == '.')
+    {
+        ++localStart;
+    }
+
+    size_t domainEnd = at + 1;
+    while (domainEnd < length && sproutIsEmailDomainCharacter(bytes[domainEnd]))
+    {
+        ++domainEnd;
+    }
+    while (domainEnd > at + 1 && (bytes[domainEnd - 1] == '.' || bytes[domainEnd - 1] == '-'))
+    {
+        --domainEnd;
+    }
+
+    //There must be a local part, and a domain with a dot and a top level domain of at least two letters
+    size_t lastDot = domainEnd;
+    for (size_t i = at + 1; i < domainEnd; ++i)
+    {
+        if (bytes[i] == '.')
+        {
+            lastDot = i;
+        }
+    }
+    if (localStart == at || lastDot == domainEnd || lastDot == at + 1 || domainEnd - lastDot < 3)
+    {
+        return NO;
+    }
+
+    *start = localStart;
+    *end = domainEnd;
+    return YES;
+}
+
+static BOOL sproutPassesLuhnCheck(const uint8_t *bytes, size_t start, size_t end)
+{
+    uint32_t sum = 0;
+    BOOL doubled = NO;
+    for (size_t i = end; i > start; --i)
+    {
+        uint8_t byte = bytes[i - 1];
+        if (!sproutIsDigit(byte))
+        {
+            continue;
+        }
+
+        uint32_t digit = byte - '0';
+        if (doubled)
+        {
+            digit *= 2;
+            if (digit > 9)
+            {
+                digit -= 9;
+            }
+        }
+        sum += digit;
+        doubled = !doubled;
+    }
+
+    return sum % 10 == 0;
+}
+
+static void sproutCheckCardNumber(const uint8_t *bytes, size_t length, size_t start, size_t end, uint32_t digits, uint32_t pattern, SproutRedactions *redactions)
+{
+    if (digits < 13 || digits > 19)
+    {
+        return;
+    }
+
+    //Not part of a longer word (i.e. a hexadecimal identifier)
+    if ((start > 0 && sproutIsAlphanumeric(bytes[start - 1])) || (end < length && sproutIsAlphanumeric(bytes[end])))
+    {
+        return;
+    }
+
+    //Payment cards are issued with a major industry identifier (the first digit) of 2 to 6, which rules out most numeric
+    //identifiers and timestamps (i.e. milliseconds since 1970 start with a 1)
+    if (bytes[start] < '2' || bytes[start] > '6')
+    {
+        return;
+    }
+
+    if (sproutPassesLuhnCheck(bytes, start, end))
+    {
+        sproutRedactionsAdd(redactions, start, end, pattern);
+    }
+}
+
+/**
+ Scans the bytes once, adding the redactions found, and flagging (in `anchorHits`) the patterns which need a regular
+ expression evaluated.
+ */
+static void sproutRedactionScan(const SproutAutomaton *automaton, const SproutRedactionKind *kinds, uint32_t cardNumberPattern, const uint8_t *bytes, size_t length, SproutRedactions *redactions, uint8_t *anchorHits)
+{
+    const uint32_t *transitions = automaton->transitions;
+    BOOL cardNumbers = cardNumberPattern != SPROUT_AUTOMATON_NONE;
+    uint32_t state = 0;
+
+    size_t runStart = 0;
+    size_t runEnd = 0;
+    uint32_t runDigits = 0;
+
+    for (size_t i = 0; i < length; ++i)
+    {
+        uint8_t byte = bytes[i];
+        state = transitions[(size_t)state * 256 + byte];
+
+        uint32_t output = automaton->firstKeyword[state] != SPROUT_AUTOMATON_NONE ? state : automaton->outputLink[state];
+        for (; output != SPROUT_AUTOMATON_NONE; output = automaton->outputLink[output])
+        {
+            for (uint32_t k = automaton->firstKeyword[output]; k != SPROUT_AUTOMATON_NONE; k = automaton->nextKeyword[k])
+            {
+                uint32_t pattern = automaton->keywordPattern[k];
+                switch (kinds[pattern])
+                {
+                    case SproutRedactionKindLiteral:
+                        sproutRedactionsAdd(redactions, i + 1 - automaton->keywordLength[k], i + 1, pattern);
+                        break;
+                    case SproutRedactionKindPrefix:
+                    {
+                        size_t valueEnd = i + 1;
+                        while (valueEnd < length && !sproutIsValueDelimiter(bytes[valueEnd]))
+                        {
+                            ++valueEnd;
+                        }
+                        if (valueEnd > i + 1)
+                        {
+                            sproutRedactionsAdd(redactions, i + 1, valueEnd, pattern);
+                        }
+                        break;
+                    }
+                    case SproutRedactionKindEmailAddress:
+                    {
+                        size_t start = 0;
+                        size_t end = 0;
+                        if (sproutEmailAddressRange(bytes, length, i, &start, &end))
+                        {
+                            sproutRedactionsAdd(redactions, start, end, pattern);
+                        }
+                        break;
+                    }
+                    case SproutRedactionKindRegularExpression:
+                        anchorHits[pattern] = 1;
+                        break;
+                    case SproutRedactionKindCardNumber:
+                        break;
+                }
+            }
+        }
+
+        if (cardNumbers)
+        {
+            if (sproutIsDigit(byte))
+            {
+                if (runDigits == 0)
+                {
+                    runStart = i;
+                }
+                ++runDigits;
+                runEnd = i + 1;
+            }
+            else if (runDigits > 0 && (runEnd != i || (byte != ' ' && byte != '-')))
+            {
+                //Digits may be grouped by single spaces or dashes, anything else ends the run
+                sproutCheckCardNumber(bytes, length, runStart, runEnd, runDigits, cardNumberPattern, redactions);
+                runDigits = 0;
+            }
+        }
+    }
+
+    if (runDigits > 0)
+    {
+        sproutCheckCardNumber(bytes, length, runStart, runEnd, runDigits, cardNumberPattern, redactions);
+    }
+}
+
+static int sproutCompareRedactions(const void *a, const void *b)
+{
+    const SproutRedaction *first = a;
+    const SproutRedaction *second = b;
+    if (first->start != second->start)
+    {
+        return first->start < second->start ? -1 : 1;
+    }
+    return first->end < second->end ? 1 : (first->end > second->end ? -1 : 0);
+}
+
+//Writes the bytes with the (sorted) redactions replaced
+static void sproutApplyRedactions(const uint8_t *bytes, size_t length, const SproutRedactions *redactions, const uint8_t *replacement, size_t replacementLength, SproutLogBuffer *buffer)
+{
+    size_t offset = 0;
+    for (size_t r = 0; r < redactions->count; ++r)
+    {
+        const SproutRedaction *redaction = &redactions->items[r];
+        if (r > 0 && redaction->start <= offset)
+        {
+            //Overlaps (or adjoins) the previous redaction, so is covered by the same replacement
+            offset = MAX(offset, redaction->end);
+            continue;
+        }
+
+        SproutLogBufferAppendBytes(buffer, bytes + offset, redaction->start - offset);
+        SproutLogBufferAppendBytes(buffer, replacement, replacementLength);
+        offset = redaction->end;
+    }
+    SproutLogBufferAppendBytes(buffer, bytes + offset, length - offset);
+}
+
+#pragma mark - SproutRedactionPattern
+
+@interface SproutRedactionPattern ()
+
+@property (nonatomic, assign) SproutRedactionKind kind;
+@property (nonatomic, copy) NSString *name;
+@property (nonatomic, copy) NSString *text;
+@property (nonatomic, strong) NSRegularExpression *regularExpression;
+
+@end
+
+@implementation SproutRedactionPattern
+
++ (instancetype)patternWithKind:(SproutRedactionKind)kind text:(NSString *)text name:(NSString *)name
+{
+    SproutRedactionPattern *retVal = [[self alloc] init];
+    retVal.kind = kind;
+    retVal.text = text;
+    retVal.name = name;
+    return retVal;
+}
+
++ (instancetype)literal:(NSString *)literal name:(NSString *)name
+{
+    return [self patternWithKind:SproutRedactionKindLiteral text:literal name:name];
+}
+
++ (instancetype)prefix:(NSString *)prefix name:(NSString *)name
+{
+    return [self patternWithKind:SproutRedactionKindPrefix text:prefix name:name];
+}
+
++ (instancetype)emailAddress
+{
+    return [self patternWithKind:SproutRedactionKindEmailAddress text:@"@" name:@"email"];
+}
+
++ (instancetype)cardNumber
+{
+    return [self patternWithKind:SproutRedactionKindCardNumber text:nil name:@"cardNumber"];
+}
+
++ (instancetype)regularExpression:(NSRegularExpression *)regularExpression anchor:(NSString *)anchor name:(NSString *)name
+{
+    SproutRedactionPattern *retVal = [self patternWithKind:SproutRedactionKindRegularExpression text:anchor name:name];
+    retVal.regularExpression = regularExpression;
+    return retVal;
+}
+
+@end
+
+#pragma mark - SproutRedactor
+
+@interface SproutRedactor ()
+{
+    SproutAutomaton _automaton;
+    SproutRedactionKind *_kinds;
+    uint32_t _cardNumberPattern;
+    BOOL _hasRegularExpressions;
+    NSData *_replacementData;
+    _Atomic(uint64_t) *_hits;
+}
+
+@end
+
+@implementation SproutRedactor
+
+- (instancetype)init
+{
+    return [self initWithPatterns:@[] replacement:nil];
+}
+
+- (instancetype)initWithPatterns:(NSArray<SproutRedactionPattern *> *)patterns
+{
+    return [self initWithPatterns:patterns replacement:nil];
+}
+
+- (instancetype)initWithPatterns:(NSArray<SproutRedactionPattern *> *)patterns replacement:(NSString *)replacement
+{
+    if ((self = [super init]))
+    {
+        _patterns = [patterns copy] ?: @[];
+        _replacement = [replacement copy] ?: @"<redacted>";
+        _replacementData = [_replacement dataUsingEncoding:NSUTF8StringEncoding];
+
+        NSUInteger count = MAX(_patterns.count, 1);
+        _kinds = calloc(count, sizeof(SproutRedactionKind));
+        _hits = calloc(count, sizeof(_Atomic(uint64_t)));
+        _cardNumberPattern = SPROUT_AUTOMATON_NONE;
+
+        NSMutableArray<NSData *> *keywordData = [NSMutableArray arrayWithCapacity:_patterns.count];
+        SproutKeyword *keywords = calloc(count, sizeof(SproutKeyword));
+        uint32_t keywordCount = 0;
+
+        for (uint32_t p = 0; p < (uint32_t)_patterns.count; ++p)
+        {
+            SproutRedactionPattern *pattern = _patterns[p];
+            _kinds[p] = pattern.kind;
+
+            if (pattern.kind == SproutRedactionKindCardNumber)
+            {
+                _cardNumberPattern = p;
+                continue;
+            }
+            if (pattern.kind == SproutRedactionKindRegularExpression)
+            {
+                _hasRegularExpressions = YES;
+            }
+
+            NSData *data = [pattern.text dataUsingEncoding:NSUTF8StringEncoding];
+            if (data.length == 0)
+            {
+                continue;
+            }
+            [keywordData addObject:data];
+            keywords[keywordCount++] = (SproutKeyword){ data.bytes, (uint32_t)data.length, p };
+        }
+
+        sproutAutomatonBuild(&_automaton, keywords, keywordCount);
+        free(keywords);
+    }
+
+    return self;
+}
+
+- (void)dealloc
+{
+    sproutAutomatonFree(&_automaton);
+    free(_kinds);
+    free(_hits);
+}
+
+#pragma mark SproutLogStage
+
+- (NSString *)processMessage:(NSString *)message
+{
+    return [self redactString:message];
+}
+
+#pragma mark Public
+
+- (NSString *)redactString:(NSString *)string
+{
+    if (string.length == 0 || self.patterns.count == 0)
+    {
+        return string;
+    }
+
+    __block NSString *retVal = string;
+
+    SproutLogBufferWithUTF8(string, ^(const uint8_t *bytes, size_t length) {
+        SproutRedactions redactions;
+        redactions.items = redactions.stack;
+        redactions.count = 0;
+        redactions.capacity = sizeof(redactions.stack) / sizeof(redactions.stack[0]);
+
+        uint8_t anchorHitsStack[64];
+        NSUInteger patternCount = self.patterns.count;
+        uint8_t *anchorHits = patternCount <= sizeof(anchorHitsStack) ? anchorHitsStack : malloc(patternCount);
+        memset(anchorHits, 0, patternCount);
+
+        sproutRedactionScan(&self->_automaton, self->_kinds, self->_cardNumberPattern, bytes, length, &redactions, anchorHits);
+
+        if (self->_hasRegularExpressions)
+        {
+            [self addRegularExpressionRedactionsInString:string length:length anchorHits:anchorHits toRedactions:&redactions];
+        }
+
+        if (redactions.count > 0)
+        {
+            for (size_t r = 0; r < redactions.count; ++r)
+            {
+                atomic_fetch_add_explicit(&self->_hits[redactions.items[r].pattern], 1, memory_order_relaxed);
+            }
+
+            qsort(redactions.items, redactions.count, sizeof(SproutRedaction), sproutCompareRedactions);
+
+            SproutLogBuffer buffer;
+            SproutLogBufferInit(&buffer);
+            sproutApplyRedactions(bytes, length, &redactions, self->_replacementData.bytes, self->_replacementData.length, &buffer);
+            retVal = SproutLogBufferCopyString(&buffer);
+        }
+
+        if (anchorHits != anchorHitsStack)
+        {
+            free(anchorHits);
+        }
+        if (redactions.items != redactions.stack)
+        {
+            free(redactions.items);
+        }
+    });
+
+    return retVal;
+}
+
+- (NSDictionary<NSString *, NSNumber *> *)hitCounts
+{
+    NSMutableDictionary<NSString *, NSNumber *> *retVal = [NSMutableDictionary dictionaryWithCapacity:self.patterns.count];
+    [self.patterns enumerateObjectsUsingBlock:^(SproutRedactionPattern *pattern, NSUInteger idx, BOOL *stop) {
+        uint64_t hits = atomic_load_explicit(&self->_hits[idx], memory_order_relaxed);
+        NSString *name = pattern.name ?: @"";
+        retVal[name] = @(retVal[name].unsignedLongLongValue + hits);
+    }];
+    return retVal;
+}
+
+#pragma mark Helpers
+
+- (void)addRegularExpressionRedactionsInString:(NSString *)string length:(size_t)length anchorHits:(const uint8_t *)anchorHits toRedactions:(SproutRedactions *)redactions
+{
+    [self.patterns enumerateObjectsUsingBlock:^(SproutRedactionPattern *pattern, NSUInteger idx, BOOL *stop) {
+        if (!anchorHits[idx] || !pattern.regularExpression)
+        {
+            return;
+        }
+
+        NSArray<NSTextCheckingResult *> *matches = [pattern.regularExpression matchesInString:string options:0 range:NSMakeRange(0, string.length)];
+        for (NSTextCheckingResult *match in matches)
+        {
+            if (match.range.length == 0)
+            {
+                continue;
+            }
+
+            //Regular expressions match UTF-16, the redactions are of UTF-8
+            size_t start = [[string substringToIndex:match.range.location] lengthOfBytesUsingEncoding:NSUTF8StringEncoding];
+            size_t end = start + [[string substringWithRange:match.range] lengthOfBytesUsingEncoding:NSUTF8StringEncoding];
+            if (end > start && end <= length)
+            {
+                sproutRedactionsAdd(redactions, start, end, (uint32_t)idx);
+            }
+        }
+    }];
+}
+
+@end
@@ -0,0 +1,74 @@
+//
+//  SproutSharedLogFormatter.h
+//
+//  Part of "Sprout" https://github.com/levigroker/Sprout
+//
+//  Created on October 19, 2026.
+//  Copyright (c) 2026 Levi Brown <mailto:levigroker@gmail.com> This work is
+//  licensed under the Creative Commons Attribution 4.0 International License. To
+//  view a copy of this license, visit https://creativecommons.org/licenses/by/4.0/
+//  or send a letter to Creative Commons, PO Box 1866, Mountain View, CA 94042, USA.
+//
+//  The above attribution and the included license must accompany any version of
+//  the source code, binary distributable, or derivatives.
+//
+
+#import <Foundation/Foundation.h>
+#import <CocoaLumberjack/CocoaLumberjack.h>
+
+/**
+ Implemented by log formatters which can tell whether another formatter would format every message identically, so
+ loggers with equivalent formatters can share one formatted result (see `SproutSharedLogFormatter`).
+ Sprout's own log formatters all implement it.
+ */
+@protocol SproutLogFormatterEquivalence <DDLogFormatter>
+
+/**
+ @param formatter Another log formatter.
+ @return `YES` if the given formatter formats every log message exactly as this one does.
+ */
+- (BOOL)isEquivalentToLogFormatter:(id<DDLogFormatter>)formatter;
+
+@end
+
+/**
+ @return `YES` if the two formatters are the same formatter, or the first declares itself equivalent to the second.
+ */
+extern BOOL SproutLogFormattersAreEquivalent(id<DDLogFormatter> formatter, id<DDLogFormatter> otherFormatter);
+
+/**
+ For loggers which write log messages themselves rather than the text their formatter makes of them (i.e.
+ `SproutBinaryFileLogger`), so they still honor the level of a `SproutSharedLogFormatter`.
+
+ @param formatter A log formatter (i.e. a logger's `logFormatter`). May be `nil`.
+ @param logMessage A log message.
+ @return `NO` if the formatter is a `SproutSharedLogFormatter` whose `logLevel` excludes the message, otherwise `YES`.
+ */
+extern BOOL SproutLogFormatterAcceptsLogMessage(id<DDLogFormatter> formatter, DDLogMessage *logMessage);
+
+/**
+ A log formatter which shares its formatted messages between loggers.
+
+ Each logger needs its own `SproutSharedLogFormatter`, but loggers whose shared formatters wrap the same `formatter` only
+ format each message once: the first logger to format a message keeps the result with the message (see
+ `SproutLogMessageSlotValue`), and the other loggers use it. Sprout wraps the formatter of every logger added with
+ `addLogger:`, and has loggers with equivalent formatters share one.
+
+ The wrapped formatter must be thread safe, and its configuration should not change once it is shared.
+
+ It also filters messages by its logger's level (see `logLevel`), so Sprout can change the level of a logger without
+ removing it from (and adding it back to) `DDLog`.
+ */
+@interface SproutSharedLogFormatter : NSObject <DDLogFormatter>
+
+@property (nonatomic, strong, readonly) id<DDLogFormatter> formatter;
+
+/**
+ The level of the messages to format. Other messages are formatted as `nil`, which loggers take to mean the message should
+ not be logged. Defaults to `DDLogLevelAll`. May be changed at any time, from any thread.
+ */
+@property (nonatomic, assign) DDLogLevel logLevel;
+
+- (instancetype)initWithLogFormatter:(id<DDLogFormatter>)formatter;
+
+@end
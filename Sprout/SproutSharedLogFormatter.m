@@ -0,0 +1,115 @@
+//
+//  SproutSharedLogFormatter.m
+//
+//  Part of "Sprout" https://github.com/levigroker/Sprout
+//
+//  Created on October 19, 2026.
+//  Copyright (c) 2026 Levi Brown <mailto:levigroker@gmail.com> This work is
+//  licensed under the Creative Commons Attribution 4.0 International License. To
+//  view a copy of this license, visit https://creativecommons.org/licenses/by/4.0/
+//  or send a letter to Creative Commons, PO Box 1866, Mountain View, CA 94042, USA.
+//
+//  The above attribution and the included license must accompany any version of
+//  the source code, binary distributable, or derivatives.
+//
+
+#import "SproutSharedLogFormatter.h"
+#import "SproutLogMessageSlots.h"
+
+BOOL SproutLogFormattersAreEquivalent(id<DDLogFormatter> formatter, id<DDLogFormatter> otherFormatter)
+{
+    if (formatter == otherFormatter)
+    {
+        return YES;
+    }
+
+    if (!formatter || !otherFormatter || ![formatter conformsToProtocol:@protocol(SproutLogFormatterEquivalence)])
+    {
+        return NO;
+    }
+
+    return [(id<SproutLogFormatterEquivalence>)formatter isEquivalentToLogFormatter:otherFormatter];
+}
+
+BOOL SproutLogFormatterAcceptsLogMessage(id<DDLogFormatter> formatter, DDLogMessage *logMessage)
+{
+    if (![formatter isKindOfClass:[SproutSharedLogFormatter class]])
+    {
+        return YES;
+    }
+
+    return (((SproutSharedLogFormatter *)formatter).logLevel & logMessage->_flag) != 0;
+}
+
+@interface SproutSharedLogFormatter ()
+{
+    //Read on the logger's queue for every message, and set from any thread
+    uint32_t _logLevel;
+}
+
+@end
+
+@implementation SproutSharedLogFormatter
+
+- (instancetype)initWithLogFormatter:(id<DDLogFormatter>)formatter
+{
+    if ((self = [super init]))
+    {
+        _formatter = formatter;
+        _logLevel = (uint32_t)DDLogLevelAll;
+    }
+
+    return self;
+}
+
+- (DDLogLevel)logLevel
+{
+    return (DDLogLevel)__atomic_load_n(&_logLevel, __ATOMIC_RELAXED);
+}
+
+- (void)setLogLevel:(DDLogLevel)logLevel
+{
+    __atomic_store_n(&_logLevel, (uint32_t)logLevel, __ATOMIC_RELAXED);
+}
+
+#pragma mark DDLogFormatter
+
+- (NSString *)formatLogMessage:(DDLogMessage *)logMessage
+{
+    if (!(self.logLevel & logMessage->_flag))
+    {
+        return nil;
+    }
+
+    id<DDLogFormatter> formatter = self.formatter;
+    if (!formatter)
+    {
+        return logMessage->_message;
+    }
+
+    return SproutLogMessageSlotValue(logMessage, (__bridge const void *)formatter, ^id{
+        return [formatter formatLogMessage:logMessage];
+    });
+}
+
+- (void)didAddToLogger:(id<DDLogger>)logger inQueue:(dispatch_queue_t)queue
+{
+    if ([self.formatter respondsToSelector:@selector(didAddToLogger:inQueue:)])
+    {
+        [self.formatter didAddToLogger:logger inQueue:queue];
+    }
+    else if ([self.formatter respondsToSelector:@selector(didAddToLogger:)])
+    {
+        [self.formatter didAddToLogger:logger];
+    }
+}
+
+- (void)willRemoveFromLogger:(id<DDLogger>)logger
+{
+    if ([self.formatter respondsToSelector:@selector(willRemoveFromLogger:)])
+    {
+        [self.formatter willRemoveFromLogger:logger];
+    }
+}
+
+@end
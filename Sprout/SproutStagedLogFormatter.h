@@ -0,0 +1,72 @@
+//
+//  SproutStagedLogFormatter.h
+//
+//  Part of "Sprout" https://github.com/levigroker/Sprout
+//
+//  Created on October 19, 2026.
+//  Copyright (c) 2026 Levi Brown <mailto:levigroker@gmail.com> This work is
+//  licensed under the Creative Commons Attribution 4.0 International License. To
+//  view a copy of this license, visit https://creativecommons.org/licenses/by/4.0/
+//  or send a letter to Creative Commons, PO Box 1866, Mountain View, CA 94042, USA.
+//
+//  The above attribution and the included license must accompany any version of
+//  the source code, binary distributable, or derivatives.
+//
+
+#import <Foundation/Foundation.h>
+#import <CocoaLumberjack/CocoaLumberjack.h>
+#import "SproutSharedLogFormatter.h"
+
+/**
+ A stage which processes the text of log messages before they are formatted (i.e. `SproutRedactor`).
+ Stages are shared between loggers (and their queues), so must be thread safe.
+ */
+@protocol SproutLogStage <NSObject>
+
+/**
+ @param message The text of a log message.
+ @return The processed text. If there was nothing to change this should be the given message.
+ */
+- (NSString *)processMessage:(NSString *)message;
+
+@end
+
+/**
+ A log formatter which runs a stage on each log message before handing it to another log formatter.
+ The stage processes the message text, and the string values of its fields and diagnostic context (see SproutLogFields.h).
+
+ Each logger needs its own formatter, but the stage only runs once per message however many loggers the message is
+ delivered to: the processed message is kept with the original message (see `SproutLogMessageSlotValue`) and shared by
+ every `SproutStagedLogFormatter` with the same stage.
+ */
+@interface SproutStagedLogFormatter : NSObject <SproutLogFormatterEquivalence>
+
+@property (nonatomic, strong, readonly) id<SproutLogStage> stage;
+@property (nonatomic, strong, readonly) id<DDLogFormatter> formatter;
+
+/**
+ @param stage The stage to run on each log message. Share the stage between formatters, so it only runs once per message.
+ @param formatter The log formatter to format the processed log messages with. If `nil` the processed message text is used
+ as is.
+ */
+- (instancetype)initWithStage:(id<SproutLogStage>)stage formatter:(id<DDLogFormatter>)formatter;
+
+/**
+ @param logMessage A log message.
+ @return The log message with its text processed by the stage (shared with every formatter with the same stage), or the
+ given message if the stage changed nothing.
+ */
+- (DDLogMessage *)processedLogMessage:(DDLogMessage *)logMessage;
+
+@end
+
+/**
+ Runs the stages of a log formatter on a log message, for loggers which write log messages themselves rather than the text
+ their formatter makes of them (i.e. `SproutBinaryFileLogger`), so nothing is written which a stage (i.e. `SproutRedactor`)
+ would have removed. `SproutSharedLogFormatter`s and `SproutStagedLogFormatter`s are looked through for stages.
+
+ @param logMessage A log message.
+ @param formatter A log formatter (i.e. a logger's `logFormatter`). May be `nil`.
+ @return The processed log message, or the given message if the formatter has no stages, or they changed nothing.
+ */
+extern DDLogMessage *SproutLogMessageProcessedForLogFormatter(DDLogMessage *logMessage, id<DDLogFormatter> formatter);
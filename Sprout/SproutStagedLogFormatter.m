@@ -0,0 +1,137 @@
+//
+//  SproutStagedLogFormatter.m
+//
+//  Part of "Sprout" https://github.com/levigroker/Sprout
+//
+//  Created on October 19, 2026.
+//  Copyright (c) 2026 Levi Brown <mailto:levigroker@gmail.com> This work is
+//  licensed under the Creative Commons Attribution 4.0 International License. To
+//  view a copy of this license, visit https://creativecommons.org/licenses/by/4.0/
+//  or send a letter to Creative Commons, PO Box 1866, Mountain View, CA 94042, USA.
+//
+//  The above attribution and the included license must accompany any version of
+//  the source code, binary distributable, or derivatives.
+//
+
+#import "SproutStagedLogFormatter.h"
+#import "SproutLogMessageSlots.h"
+#import "SproutLogFields.h"
+
+DDLogMessage *SproutLogMessageProcessedForLogFormatter(DDLogMessage *logMessage, id<DDLogFormatter> formatter)
+{
+    DDLogMessage *retVal = logMessage;
+    while (formatter)
+    {
+        if ([formatter isKindOfClass:[SproutSharedLogFormatter class]])
+        {
+            formatter = ((SproutSharedLogFormatter *)formatter).formatter;
+        }
+        else if ([formatter isKindOfClass:[SproutStagedLogFormatter class]])
+        {
+            SproutStagedLogFormatter *stagedFormatter = (SproutStagedLogFormatter *)formatter;
+            retVal = [stagedFormatter processedLogMessage:retVal];
+            formatter = stagedFormatter.formatter;
+        }
+        else
+        {
+            break;
+        }
+    }
+
+    return retVal;
+}
+
+@implementation SproutStagedLogFormatter
+
+- (instancetype)initWithStage:(id<SproutLogStage>)stage formatter:(id<DDLogFormatter>)formatter
+{
+    if ((self = [super init]))
+    {
+        _stage = stage;
+        _formatter = formatter;
+    }
+
+    return self;
+}
+
+- (DDLogMessage *)processedLogMessage:(DDLogMessage *)logMessage
+{
+    id<SproutLogStage> stage = self.stage;
+    if (!stage || !logMessage)
+    {
+        return logMessage;
+    }
+
+    return SproutLogMessageSlotValue(logMessage, (__bridge const void *)stage, ^id{
+        NSString *message = [stage processMessage:logMessage->_message];
+
+        //Field and diagnostic context values are written along with the message, so are processed too
+        id representedObject = logMessage->_representedObject;
+        NSString *(^processValue)(NSString *) = ^NSString *(NSString *value) {
+            return [stage processMessage:value];
+        };
+        if ([representedObject isKindOfClass:[SproutLogFields class]])
+        {
+            representedObject = [(SproutLogFields *)representedObject fieldsByProcessingStringValues:processValue];
+        }
+        else if ([representedObject isKindOfClass:[SproutDiagnosticContext class]])
+        {
+            representedObject = [(SproutDiagnosticContext *)representedObject contextByProcessingValues:processValue];
+        }
+
+        if (message == logMessage->_message && representedObject == logMessage->_representedObject)
+        {
+            return logMessage;
+        }
+
+        DDLogMessage *retVal = [logMessage copy];
+        retVal->_message = [message copy];
+        retVal->_representedObject = representedObject;
+        return retVal;
+    });
+}
+
+#pragma mark DDLogFormatter
+
+- (NSString *)formatLogMessage:(DDLogMessage *)logMessage
+{
+    DDLogMessage *processedMessage = [self processedLogMessage:logMessage];
+
+    id<DDLogFormatter> formatter = self.formatter;
+    return formatter ? [formatter formatLogMessage:processedMessage] : processedMessage->_message;
+}
+
+- (void)didAddToLogger:(id<DDLogger>)logger inQueue:(dispatch_queue_t)queue
+{
+    if ([self.formatter respondsToSelector:@selector(didAddToLogger:inQueue:)])
+    {
+        [self.formatter didAddToLogger:logger inQueue:queue];
+    }
+    else if ([self.formatter respondsToSelector:@selector(didAddToLogger:)])
+    {
+        [self.formatter didAddToLogger:logger];
+    }
+}
+
+- (void)willRemoveFromLogger:(id<DDLogger>)logger
+{
+    if ([self.formatter respondsToSelector:@selector(willRemoveFromLogger:)])
+    {
+        [self.formatter willRemoveFromLogger:logger];
+    }
+}
+
+#pragma mark SproutLogFormatterEquivalence
+
+- (BOOL)isEquivalentToLogFormatter:(id<DDLogFormatter>)formatter
+{
+    if (![formatter isMemberOfClass:[self class]])
+    {
+        return NO;
+    }
+
+    SproutStagedLogFormatter *other = (SproutStagedLogFormatter *)formatter;
+    return self.stage == other.stage && SproutLogFormattersAreEquivalent(self.formatter, other.formatter);
+}
+
+@end
@@ -0,0 +1,74 @@
+//
+//  SproutTemplateLogFormatter.h
+//
+//  Part of "Sprout" https://github.com/levigroker/Sprout
+//
+//  Created on October 19, 2026.
+//  Copyright (c) 2026 Levi Brown <mailto:levigroker@gmail.com> This work is
+//  licensed under the Creative Commons Attribution 4.0 International License. To
+//  view a copy of this license, visit https://creativecommons.org/licenses/by/4.0/
+//  or send a letter to Creative Commons, PO Box 1866, Mountain View, CA 94042, USA.
+//
+//  The above attribution and the included license must accompany any version of
+//  the source code, binary distributable, or derivatives.
+//
+
+#import <Foundation/Foundation.h>
+#import <CocoaLumberjack/CocoaLumberjack.h>
+#import "SproutLogSanitizer.h"
+#import "SproutSharedLogFormatter.h"
+
+/**
+ The template which reproduces the `SproutCustomLogFormatter` layout.
+ */
+extern NSString * const SproutDefaultLogTemplate;
+
+/**
+ A log formatter whose layout is given by a template, i.e. `@"%T <%t> %F(%f %n)\n%T %L %m"`.
+
+ The template is parsed once, when the formatter is created, into a list of operations, so formatting a message just
+ runs those operations into a buffer (on the stack, for all but the longest messages) and makes a single string from it.
+ Timestamps are rendered without an `NSDateFormatter`: the date and time up to the second are cached, and only the
+ milliseconds are rendered for each message.
+
+ Template directives:
+
+     %T   Timestamp, in the local time zone (i.e. `2014-05-20 16:06:45:602`)
+     %t   Thread ID
+     %N   Thread name
+     %q   Queue label
+     %F   Function
+     %f   File name (without the path)
+     %n   Line number
+     %L   Log level (`[ERROR]`, ` [WARN]`, ` [INFO]` or `[DEBUG]`, as `SproutCustomLogFormatter` writes them)
+     %c   Context
+     %m   Message
+     %K   The key/value fields of the message (see `SproutLogFields.h`), as ` key=value ...`, or nothing if it has none
+     %X   The diagnostic context (see `SproutDiagnosticContext`) captured by the message, as ` {key=value ...}`, or nothing
+          if the message has none
+     %%   A literal `%`
+
+ Any other character following a `%` is written as is (along with the `%`).
+ */
+@interface SproutTemplateLogFormatter : NSObject <SproutLogFormatterEquivalence>
+
+@property (nonatomic, copy, readonly) NSString *formatTemplate;
+
+/**
+ If set, log messages (`%m`) are sanitized (i.e. multi-line messages are escaped or indented) as they are formatted.
+ */
+@property (nonatomic, strong) SproutLogSanitizer *messageSanitizer;
+
+/**
+ Creates a formatter with the `SproutDefaultLogTemplate`.
+ */
+- (instancetype)init;
+
+/**
+ Creates a formatter with the given template.
+
+ @param formatTemplate The template describing the layout of each formatted log message (see above).
+ */
+- (instancetype)initWithFormatTemplate:(NSString *)formatTemplate NS_DESIGNATED_INITIALIZER;
+
+@end
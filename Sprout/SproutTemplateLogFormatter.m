@@ -0,0 +1,313 @@
+//
+//  SproutTemplateLogFormatter.m
+//
+//  Part of "Sprout" https://github.com/levigroker/Sprout
+//
+//  Created on October 19, 2026.
+//  Copyright (c) 2026 Levi Brown <mailto:levigroker@gmail.com> This work is
+//  licensed under the Creative Commons Attribution 4.0 International License. To
+//  view a copy of this license, visit https://creativecommons.org/licenses/by/4.0/
+//  or send a letter to Creative Commons, PO Box 1866, Mountain View, CA 94042, USA.
+//
+//  The above attribution and the included license must accompany any version of
+//  the source code, binary distributable, or derivatives.
+//
+
+#include <math.h>
+#include <os/lock.h>
+#include <time.h>
+
+#import "SproutTemplateLogFormatter.h"
+#import "SproutLogBuffer.h"
+#import "SproutLogFields.h"
+
+NSString * const SproutDefaultLogTemplate = @"%T         <%t> %F(%f %n)\n%T %L %m%K%X";
+
+typedef enum
+{
+    SproutTemplateOpLiteral,
+    SproutTemplateOpTimestamp,
+    SproutTemplateOpThreadID,
+    SproutTemplateOpThreadName,
+    SproutTemplateOpQueueLabel,
+    SproutTemplateOpFunction,
+    SproutTemplateOpFile,
+    SproutTemplateOpLine,
+    SproutTemplateOpLevel,
+    SproutTemplateOpContext,
+    SproutTemplateOpMessage,
+    SproutTemplateOpFields,
+    SproutTemplateOpDiagnosticContext,
+} SproutTemplateOpType;
+
+typedef struct
+{
+    SproutTemplateOpType type;
+    //For `SproutTemplateOpLiteral`, the range of the literal's bytes in `_literals`
+    size_t offset;
+    size_t length;
+} SproutTemplateOp;
+
+//"yyyy-MM-dd HH:mm:ss:"
+#define SPROUT_TIMESTAMP_PREFIX_LENGTH 20
+
+@interface SproutTemplateLogFormatter ()
+{
+    SproutTemplateOp *_ops;
+    NSUInteger _opCount;
+    NSData *_literals;
+
+    //The rendered timestamp prefix for `_cachedSecond`, guarded by `_timestampLock`
+    os_unfair_lock _timestampLock;
+    time_t _cachedSecond;
+    char _cachedPrefix[SPROUT_TIMESTAMP_PREFIX_LENGTH];
+}
+
+@end
+
+@implementation SproutTemplateLogFormatter
+
+- (instancetype)init
+{
+    return [self initWithFormatTemplate:SproutDefaultLogTemplate];
+}
+
+- (instancetype)initWithFormatTemplate:(NSString *)formatTemplate
+{
+    if ((self = [super init]))
+    {
+        _formatTemplate = [formatTemplate copy];
+        _timestampLock = OS_UNFAIR_LOCK_INIT;
+        _cachedSecond = -1;
+        [self compileFormatTemplate:_formatTemplate];
+    }
+
+    return self;
+}
+
+- (void)dealloc
+{
+    free(_ops);
+}
+
+#pragma mark DDLogFormatter
+
+- (NSString *)formatLogMessage:(DDLogMessage *)logMessage
+{
+    const uint8_t *literals = _literals.bytes;
+    SproutLogSanitizer *sanitizer = self.messageSanitizer;
+
+    SproutLogBuffer buffer;
+    SproutLogBufferInit(&buffer);
+
+    for (NSUInteger i = 0; i < _opCount; ++i)
+    {
+        const SproutTemplateOp *op = &_ops[i];
+        switch (op->type)
+        {
+            case SproutTemplateOpLiteral:
+                SproutLogBufferAppendBytes(&buffer, literals + op->offset, op->length);
+                break;
+            case SproutTemplateOpTimestamp:
+                [self appendTimestamp:logMessage->_timestamp toBuffer:&buffer];
+                break;
+            case SproutTemplateOpThreadID:
+                SproutLogBufferAppendString(&buffer, logMessage->_threadID);
+                break;
+            case SproutTemplateOpThreadName:
+                SproutLogBufferAppendString(&buffer, logMessage->_threadName);
+                break;
+            case SproutTemplateOpQueueLabel:
+                SproutLogBufferAppendString(&buffer, logMessage->_queueLabel);
+                break;
+            case SproutTemplateOpFunction:
+                SproutLogBufferAppendString(&buffer, logMessage->_function);
+                break;
+            case SproutTemplateOpFile:
+                SproutLogBufferAppendString(&buffer, logMessage->_fileName.length > 0 ? logMessage->_fileName : [logMessage->_file lastPathComponent]);
+                break;
+            case SproutTemplateOpLine:
+                SproutLogBufferAppendInteger(&buffer, (int64_t)logMessage->_line);
+                break;
+            case SproutTemplateOpLevel:
+                SproutLogBufferAppendBytes(&buffer, [self levelForFlag:logMessage->_flag], 7);
+                break;
+            case SproutTemplateOpContext:
+                SproutLogBufferAppendInteger(&buffer, logMessage->_context);
+                break;
+            case SproutTemplateOpMessage:
+                if (sanitizer)
+                {
+                    [sanitizer appendString:logMessage->_message toBuffer:&buffer];
+                }
+                else
+                {
+                    SproutLogBufferAppendString(&buffer, logMessage->_message);
+                }
+                break;
+            case SproutTemplateOpFields:
+            {
+                SproutLogFields *fields = SproutLogMessageFields(logMessage);
+                if (fields.count > 0)
+                {
+                    SproutLogBufferAppendByte(&buffer, ' ');
+                    SproutLogBufferAppendString(&buffer, fields.renderedString);
+                }
+                break;
+            }
+            case SproutTemplateOpDiagnosticContext:
+            {
+                SproutDiagnosticContext *diagnosticContext = SproutLogMessageDiagnosticContext(logMessage);
+                if (diagnosticContext)
+                {
+                    SproutLogBufferAppendBytes(&buffer, " {", 2);
+                    SproutLogBufferAppendString(&buffer, diagnosticContext.renderedString);
+                    SproutLogBufferAppendByte(&buffer, '}');
+                }
+                break;
+            }
+        }
+    }
+
+    return SproutLogBufferCopyString(&buffer);
+}
+
+#pragma mark SproutLogFormatterEquivalence
+
+- (BOOL)isEquivalentToLogFormatter:(id<DDLogFormatter>)formatter
+{
+    if (![formatter isMemberOfClass:[self class]])
+    {
+        return NO;
+    }
+
+    SproutTemplateLogFormatter *other = (SproutTemplateLogFormatter *)formatter;
+    BOOL sameSanitizers = self.messageSanitizer == other.messageSanitizer || [self.messageSanitizer isEqual:other.messageSanitizer];
+
+    return [self.formatTemplate isEqualToString:other.formatTemplate] && sameSanitizers;
+}
+
+#pragma mark Helpers
+
+- (void)compileFormatTemplate:(NSString *)formatTemplate
+{
+    NSData *templateData = [formatTemplate dataUsingEncoding:NSUTF8StringEncoding] ?: [NSData data];
+    const uint8_t *bytes = templateData.bytes;
+    size_t length = templateData.length;
+
+    //Literals are copied, without their escapes, into one buffer referenced by the ops
+    NSMutableData *literals = [NSMutableData dataWithCapacity:length];
+    //There can be no more ops than there are bytes in the template
+    SproutTemplateOp *ops = calloc(MAX(length, 1), sizeof(SproutTemplateOp));
+    NSUInteger opCount = 0;
+
+    size_t i = 0;
+    while (i < length)
+    {
+        SproutTemplateOpType type = SproutTemplateOpLiteral;
+        size_t literalLength = 1;
+        if (bytes[i] == '%' && i + 1 < length)
+        {
+            switch (bytes[i + 1])
+            {
+                case 'T' : type = SproutTemplateOpTimestamp; break;
+                case 't' : type = SproutTemplateOpThreadID; break;
+                case 'N' : type = SproutTemplateOpThreadName; break;
+                case 'q' : type = SproutTemplateOpQueueLabel; break;
+                case 'F' : type = SproutTemplateOpFunction; break;
+                case 'f' : type = SproutTemplateOpFile; break;
+                case 'n' : type = SproutTemplateOpLine; break;
+                case 'L' : type = SproutTemplateOpLevel; break;
+                case 'c' : type = SproutTemplateOpContext; break;
+                case 'm' : type = SproutTemplateOpMessage; break;
+                case 'K' : type = SproutTemplateOpFields; break;
+                case 'X' : type = SproutTemplateOpDiagnosticContext; break;
+                case '%' : ++i; break;
+                default  : literalLength = 2; break;
+            }
+        }
+
+        if (type == SproutTemplateOpLiteral)
+        {
+            //Extend the previous op if it is also a literal
+            if (opCount == 0 || ops[opCount - 1].type != SproutTemplateOpLiteral)
+            {
+                ops[opCount++] = (SproutTemplateOp){ SproutTemplateOpLiteral, literals.length, 0 };
+            }
+            [literals appendBytes:bytes + i length:literalLength];
+            ops[opCount - 1].length += literalLength;
+            i += literalLength;
+        }
+        else
+        {
+            ops[opCount++] = (SproutTemplateOp){ type, 0, 0 };
+            i += 2;
+        }
+    }
+
+    _ops = ops;
+    _opCount = opCount;
+    _literals = [literals copy];
+}
+
+- (const char *)levelForFlag:(DDLogFlag)flag
+{
+    const char *retVal = NULL;
+    switch (flag)
+    {
+        case DDLogFlagError   : retVal = "[ERROR]"; break;
+        case DDLogFlagWarning : retVal = " [WARN]"; break;
+        case DDLogFlagInfo    : retVal = " [INFO]"; break;
+        case DDLogFlagDebug   :
+        default               : retVal = "[DEBUG]"; break;
+    }
+    return retVal;
+}
+
+- (void)appendTimestamp:(NSDate *)date toBuffer:(SproutLogBuffer *)buffer
+{
+    double timestamp = date.timeIntervalSince1970;
+    double second = floor(timestamp);
+    time_t wholeSecond = (time_t)second;
+    uint64_t milliseconds = MIN((uint64_t)((timestamp - second) * 1000.0), 999);
+
+    uint8_t *prefix = SproutLogBufferReserve(buffer, SPROUT_TIMESTAMP_PREFIX_LENGTH);
+
+    os_unfair_lock_lock(&_timestampLock);
+    if (wholeSecond != _cachedSecond)
+    {
+        [self renderTimestampPrefixForSecond:wholeSecond];
+    }
+    memcpy(prefix, _cachedPrefix, SPROUT_TIMESTAMP_PREFIX_LENGTH);
+    os_unfair_lock_unlock(&_timestampLock);
+
+    buffer->length += SPROUT_TIMESTAMP_PREFIX_LENGTH;
+    SproutLogBufferAppendPaddedInteger(buffer, milliseconds, 3);
+}
+
+//Must be called with `_timestampLock` held
+- (void)renderTimestampPrefixForSecond:(time_t)second
+{
+    struct tm components;
+    localtime_r(&second, &components);
+
+    SproutLogBuffer prefix;
+    SproutLogBufferInit(&prefix);
+    SproutLogBufferAppendPaddedInteger(&prefix, (uint64_t)(components.tm_year + 1900), 4);
+    SproutLogBufferAppendByte(&prefix, '-');
+    SproutLogBufferAppendPaddedInteger(&prefix, (uint64_t)(components.tm_mon + 1), 2);
+    SproutLogBufferAppendByte(&prefix, '-');
+    SproutLogBufferAppendPaddedInteger(&prefix, (uint64_t)components.tm_mday, 2);
+    SproutLogBufferAppendByte(&prefix, ' ');
+    SproutLogBufferAppendPaddedInteger(&prefix, (uint64_t)components.tm_hour, 2);
+    SproutLogBufferAppendByte(&prefix, ':');
+    SproutLogBufferAppendPaddedInteger(&prefix, (uint64_t)components.tm_min, 2);
+    SproutLogBufferAppendByte(&prefix, ':');
+    SproutLogBufferAppendPaddedInteger(&prefix, (uint64_t)components.tm_sec, 2);
+    SproutLogBufferAppendByte(&prefix, ':');
+
+    memcpy(_cachedPrefix, prefix.bytes, SPROUT_TIMESTAMP_PREFIX_LENGTH);
+    _cachedSecond = second;
+}
+
+@end
@@ -8,6 +8,14 @@
 
 #import <XCTest/XCTest.h>
 #import <Sprout/Sprout.h>
+#import <Sprout/SproutJSONLogFormatter.h>
+#import <Sprout/SproutCustomLogFormatter.h>
+#import <Sprout/SproutStagedLogFormatter.h>
+#import <Sprout/SproutLogFileManager.h>
+#import <Sprout/SproutBinaryFileLogger.h>
+#import <Sprout/SproutCompressedFileLogger.h>
+#import <Sprout/SproutFileLogRouter.h>
+#import <Sprout/SproutLogSanitizer.h>
 #import "CrashlyticsLogger.h"
 
 @interface SproutLibTests : XCTestCase
@@ -16,6 +24,115 @@
 
 @implementation SproutLibTests
 
+#pragma mark - Helpers
+
+- (NSDate *)localDateWithHour:(NSInteger)hour minute:(NSInteger)minute second:(NSInteger)second millisecond:(NSInteger)millisecond {
+    NSDateComponents *components = [[NSDateComponents alloc] init];
+    components.year = 2026;
+    components.month = 3;
+    components.day = 1;
+    components.hour = hour;
+    components.minute = minute;
+    components.second = second;
+    NSDate *date = [[NSCalendar currentCalendar] dateFromComponents:components];
+    return [date dateByAddingTimeInterval:millisecond / 1000.0];
+}
+
+- (DDLogMessage *)logMessage:(NSString *)text flag:(DDLogFlag)flag function:(NSString *)function line:(NSUInteger)line timestamp:(NSDate *)timestamp {
+    return [[DDLogMessage alloc] initWithMessage:text level:DDLogLevelAll flag:flag context:0 file:@"/path/to/File.m" function:function line:line tag:nil options:0 timestamp:timestamp];
+}
+
+- (NSString *)temporaryLogsDirectory {
+    NSString *logsDirectory = [NSTemporaryDirectory() stringByAppendingPathComponent:[NSUUID UUID].UUIDString];
+    [[NSFileManager defaultManager] createDirectoryAtPath:logsDirectory withIntermediateDirectories:YES attributes:nil error:nil];
+    [self addTeardownBlock:^{
+        [[NSFileManager defaultManager] removeItemAtPath:logsDirectory error:nil];
+    }];
+    return logsDirectory;
+}
+
+- (DDLogFileManagerDefault *)logFileManagerWithMessages:(NSArray<DDLogMessage *> *)messages {
+    DDLogFileManagerDefault *logFileManager = [[DDLogFileManagerDefault alloc] initWithLogsDirectory:[self temporaryLogsDirectory]];
+    NSString *logFilePath = [logFileManager createNewLogFileWithError:nil];
+    XCTAssert(logFilePath != nil, @"Log file could not be created.");
+
+    SproutCustomLogFormatter *formatter = [[SproutCustomLogFormatter alloc] init];
+    NSMutableString *text = [NSMutableString string];
+    for (DDLogMessage *message in messages) {
+        [text appendFormat:@"%@\n", [formatter formatLogMessage:message]];
+    }
+    [text writeToFile:logFilePath atomically:NO encoding:NSUTF8StringEncoding error:nil];
+    //Searches skip files created after the range they cover
+    [[NSFileManager defaultManager] setAttributes:@{NSFileCreationDate: messages.firstObject->_timestamp} ofItemAtPath:logFilePath error:nil];
+
+    return logFileManager;
+}
+
+- (NSArray<SproutLogRecord *> *)recordsForQuery:(SproutLogQuery *)query engine:(SproutLogQueryEngine *)engine {
+    NSMutableArray<SproutLogRecord *> *retVal = [NSMutableArray array];
+    XCTestExpectation *expectation = [self expectationWithDescription:@"search"];
+    dispatch_queue_t resultsQueue = dispatch_queue_create("sprout.tests.results", DISPATCH_QUEUE_SERIAL);
+
+    [engine searchWithQuery:query resultsQueue:resultsQueue resultsHandler:^(NSArray<SproutLogRecord *> *records) {
+        [retVal addObjectsFromArray:records];
+    } completion:^{
+        [expectation fulfill];
+    }];
+    [self waitForExpectationsWithTimeout:10 handler:nil];
+
+    [retVal sortUsingComparator:^NSComparisonResult(SproutLogRecord *record1, SproutLogRecord *record2) {
+        return [record1.timestamp compare:record2.timestamp];
+    }];
+    return retVal;
+}
+
+- (SproutLogFileManager *)logFileManagerWithExtension:(NSString *)extension {
+    SproutLogFileManager *retVal = [[SproutLogFileManager alloc] initWithLogsDirectory:[self temporaryLogsDirectory]];
+    retVal.logFileExtension = extension;
+    return retVal;
+}
+
+//The contents of all the log files of the given file logger, once it has written everything it was given
+- (NSData *)logFileDataOfFileLogger:(DDFileLogger *)fileLogger {
+    [fileLogger flush];
+
+    NSMutableData *retVal = [NSMutableData data];
+    for (NSString *logFilePath in fileLogger.logFileManager.sortedLogFilePaths) {
+        [retVal appendData:[NSData dataWithContentsOfFile:logFilePath] ?: [NSData data]];
+    }
+    return retVal;
+}
+
+- (BOOL)data:(NSData *)data containsString:(NSString *)string {
+    NSData *stringData = [string dataUsingEncoding:NSUTF8StringEncoding];
+    return [data rangeOfData:stringData options:0 range:NSMakeRange(0, data.length)].location != NSNotFound;
+}
+
+- (SproutStagedLogFormatter *)emailRedactingLogFormatter {
+    SproutRedactor *redactor = [[SproutRedactor alloc] initWithPatterns:@[[SproutRedactionPattern emailAddress]]];
+    return [[SproutStagedLogFormatter alloc] initWithStage:redactor formatter:nil];
+}
+
+//A byte at a time `SproutLogSanitizerScan`
+- (size_t)referenceSanitizerScanOfBytes:(const uint8_t *)bytes length:(size_t)length mode:(SproutLogSanitizerMode)mode {
+    for (size_t i = 0; i < length; ++i) {
+        uint8_t byte = bytes[i];
+        if ((byte < 0x20 && byte != '\t') || byte == 0x7F || (byte == '\\' && mode == SproutLogSanitizerModeEscape)) {
+            return i;
+        }
+    }
+    return length;
+}
+
+- (NSArray<DDLogMessage *> *)queryTestMessages {
+    //Either side of an hour boundary, to exercise the timestamp cache
+    return @[
+        [self logMessage:@"First error" flag:DDLogFlagError function:@"-[Class first]" line:10 timestamp:[self localDateWithHour:10 minute:59 second:59 millisecond:900]],
+        [self logMessage:@"Multi-line\nsecond line" flag:DDLogFlagInfo function:@"-[Class second:(int)x]" line:20 timestamp:[self localDateWithHour:11 minute:0 second:0 millisecond:100]],
+        [self logMessage:@"Debug details" flag:DDLogFlagDebug function:@"main" line:30 timestamp:[self localDateWithHour:11 minute:30 second:15 millisecond:5]],
+    ];
+}
+
 - (void)setUp {
     [super setUp];
     // Put setup code here. This method is called before the invocation of each test method in the class.
@@ -69,4 +186,374 @@
     XCTAssert(backtrace.count <= length, @"Backtrace length mismatch (expecting at least '%d' but got '%d').", (int)length, (int)backtrace.count);
 }
 
+- (void)testJSONLogFormatter100 {
+    NSString *text = @"Quote \" backslash \\ newline \n tab \t bell \a caf\u00e9 \U0001F331";
+    DDLogMessage *message = [[DDLogMessage alloc] initWithMessage:text level:DDLogLevelAll flag:DDLogFlagWarning context:7 file:@"/path/to/File.m" function:@"-[Class method]" line:42 tag:@YES options:0 timestamp:[NSDate dateWithTimeIntervalSince1970:1400627205.602]];
+
+    NSString *line = [[[SproutJSONLogFormatter alloc] init] formatLogMessage:message];
+    XCTAssert([line rangeOfString:@"\n"].location == NSNotFound, @"JSON line unexpectedly contains a newline.");
+
+    NSDictionary *object = [NSJSONSerialization JSONObjectWithData:[line dataUsingEncoding:NSUTF8StringEncoding] options:0 error:nil];
+    XCTAssert(object != nil, @"JSON line could not be parsed: %@", line);
+    XCTAssertEqualObjects(object[@"message"], text);
+    XCTAssertEqualObjects(object[@"level"], @"warning");
+    XCTAssertEqualObjects(object[@"context"], @7);
+    XCTAssertEqualObjects(object[@"file"], @"File.m");
+    XCTAssertEqualObjects(object[@"function"], @"-[Class method]");
+    XCTAssertEqualObjects(object[@"line"], @42);
+    XCTAssertEqualObjects(object[@"ts"], @1400627205602000);
+    XCTAssertEqualObjects(object[@"tag"], @YES);
+}
+
+- (void)testLogFields100 {
+    BOOL cached = YES;
+    SproutLogFields *fields = [SproutLogFields fields];
+    SPROUT_LOG_KV_ADD(fields, @"cached", SproutKVBool(cached), @"count", 3)
+
+    XCTAssertEqual(fields.count, 2);
+    XCTAssertEqual([fields typeAtIndex:0], SproutLogFieldTypeBool);
+    XCTAssertEqual([fields boolValueAtIndex:0], YES);
+    XCTAssertEqual([fields typeAtIndex:1], SproutLogFieldTypeInteger);
+    XCTAssertEqualObjects(fields.renderedString, @"cached=true count=3");
+}
+
+- (void)testLogFields200 {
+    //Values are taken when they are logged
+    NSMutableString *host = [NSMutableString stringWithString:@"example.com"];
+    NSMutableArray *items = [NSMutableArray arrayWithObject:@1];
+    SproutLogFields *fields = [SproutLogFields fields];
+    SPROUT_LOG_KV_ADD(fields, @"host", host, @"items", items)
+    [host setString:@"changed.com"];
+    [items addObject:@2];
+
+    XCTAssertEqualObjects([fields objectValueAtIndex:0], @"example.com");
+    XCTAssertEqualObjects([fields objectValueAtIndex:1], [@[@1] description]);
+}
+
+- (void)testLogFields300 {
+    //String values are redacted along with the message
+    SproutLogFields *fields = [SproutLogFields fields];
+    SPROUT_LOG_KV_ADD(fields, @"user", @"jane.doe@example.com", @"count", 3)
+    DDLogMessage *message = [[DDLogMessage alloc] initWithMessage:@"Signed in" level:DDLogLevelAll flag:DDLogFlagInfo context:0 file:@"/path/to/File.m" function:@"main" line:10 tag:fields options:0 timestamp:[NSDate date]];
+
+    DDLogMessage *processedMessage = [[self emailRedactingLogFormatter] processedLogMessage:message];
+    SproutLogFields *processedFields = SproutLogMessageFields(processedMessage);
+    XCTAssertEqualObjects(processedFields.renderedString, @"user=<redacted> count=3");
+    XCTAssertEqualObjects(fields.renderedString, @"user=jane.doe@example.com count=3");
+}
+
+- (void)testLogQuery100 {
+    NSArray<DDLogMessage *> *messages = [self queryTestMessages];
+    SproutLogQueryEngine *engine = [[SproutLogQueryEngine alloc] initWithLogFileManager:[self logFileManagerWithMessages:messages]];
+
+    NSArray<SproutLogRecord *> *records = [self recordsForQuery:[[SproutLogQuery alloc] init] engine:engine];
+    XCTAssertEqual(records.count, messages.count);
+
+    for (NSUInteger i = 0; i < MIN(records.count, messages.count); ++i) {
+        SproutLogRecord *record = records[i];
+        DDLogMessage *message = messages[i];
+        XCTAssertEqualWithAccuracy(record.timestamp.timeIntervalSince1970, message->_timestamp.timeIntervalSince1970, 0.0005);
+        XCTAssertEqual(record.flag, message->_flag);
+        XCTAssertEqualObjects(record.message, message->_message);
+        XCTAssertEqualObjects(record.function, message->_function);
+        XCTAssertEqualObjects(record.fileName, @"File.m");
+        XCTAssertEqual(record.line, message->_line);
+        XCTAssertEqual(record.context, NSNotFound);
+    }
+}
+
+- (void)testLogQuery200 {
+    NSArray<DDLogMessage *> *messages = [self queryTestMessages];
+    SproutLogQueryEngine *engine = [[SproutLogQueryEngine alloc] initWithLogFileManager:[self logFileManagerWithMessages:messages]];
+
+    SproutLogQuery *query = [[SproutLogQuery alloc] init];
+    query.flags = DDLogFlagError | DDLogFlagWarning;
+    NSArray<SproutLogRecord *> *records = [self recordsForQuery:query engine:engine];
+    XCTAssertEqual(records.count, 1);
+    XCTAssertEqualObjects(records.firstObject.message, @"First error");
+
+    query = [[SproutLogQuery alloc] init];
+    query.substring = @"second line";
+    records = [self recordsForQuery:query engine:engine];
+    XCTAssertEqual(records.count, 1);
+    XCTAssertEqual(records.firstObject.line, 20);
+
+    query = [[SproutLogQuery alloc] init];
+    query.function = @"Class";
+    query.fileName = @"File.m";
+    records = [self recordsForQuery:query engine:engine];
+    XCTAssertEqual(records.count, 2);
+
+    //Only the records after the hour boundary
+    query = [[SproutLogQuery alloc] init];
+    query.startDate = [self localDateWithHour:11 minute:0 second:0 millisecond:0];
+    query.endDate = [self localDateWithHour:11 minute:30 second:0 millisecond:0];
+    records = [self recordsForQuery:query engine:engine];
+    XCTAssertEqual(records.count, 1);
+    XCTAssertEqual(records.firstObject.flag, DDLogFlagInfo);
+
+    query = [[SproutLogQuery alloc] init];
+    query.context = @7;
+    records = [self recordsForQuery:query engine:engine];
+    XCTAssertEqual(records.count, 0);
+}
+
+- (void)testLogQueryIndex100 {
+    NSArray<DDLogMessage *> *messages = [self queryTestMessages];
+    DDLogFileManagerDefault *logFileManager = [self logFileManagerWithMessages:messages];
+    logFileManager.sortedLogFileInfos.firstObject.isArchived = YES;
+    SproutLogQueryEngine *engine = [[SproutLogQueryEngine alloc] initWithLogFileManager:logFileManager];
+
+    SproutLogQuery *query = [[SproutLogQuery alloc] init];
+    query.startDate = [self localDateWithHour:11 minute:0 second:0 millisecond:0];
+    NSArray<SproutLogRecord *> *records = [self recordsForQuery:query engine:engine];
+    XCTAssertEqual(records.count, 2);
+
+    //The first search of an archived file writes its sidecar index
+    NSString *indexDirectory = [logFileManager.logsDirectory stringByAppendingPathComponent:@".sproutindex"];
+    NSArray<NSString *> *indexFileNames = [[NSFileManager defaultManager] contentsOfDirectoryAtPath:indexDirectory error:nil];
+    XCTAssertEqual(indexFileNames.count, 1);
+
+    //Later searches use the index, and find the same records
+    NSArray<SproutLogRecord *> *indexedRecords = [self recordsForQuery:query engine:engine];
+    XCTAssertEqual(indexedRecords.count, records.count);
+    for (NSUInteger i = 0; i < MIN(records.count, indexedRecords.count); ++i) {
+        XCTAssertEqualObjects(indexedRecords[i].message, records[i].message);
+        XCTAssertEqualObjects(indexedRecords[i].timestamp, records[i].timestamp);
+    }
+
+    //The index is removed with its log file
+    [[NSFileManager defaultManager] removeItemAtPath:logFileManager.sortedLogFilePaths.firstObject error:nil];
+    XCTAssertEqual([self recordsForQuery:query engine:engine].count, 0);
+    indexFileNames = [[NSFileManager defaultManager] contentsOfDirectoryAtPath:indexDirectory error:nil];
+    XCTAssertEqual(indexFileNames.count, 0);
+}
+
+- (void)testRedactor100 {
+    //Overlapping literals, matched without regard to case, are covered by a single replacement
+    SproutRedactor *redactor = [[SproutRedactor alloc] initWithPatterns:@[
+        [SproutRedactionPattern literal:@"secret" name:@"secret"],
+        [SproutRedactionPattern literal:@"cretin" name:@"cretin"],
+        [SproutRedactionPattern literal:@"sec" name:@"sec"],
+    ]];
+
+    XCTAssertEqualObjects([redactor redactString:@"a secretin b SECRET c Sec"], @"a <redacted> b <redacted> c <redacted>");
+    NSString *clean = @"nothing to see here";
+    XCTAssert([redactor redactString:clean] == clean, @"Text without matches was copied.");
+
+    NSDictionary<NSString *, NSNumber *> *hitCounts = [redactor hitCounts];
+    XCTAssertEqualObjects(hitCounts[@"secret"], @2);
+    XCTAssertEqualObjects(hitCounts[@"cretin"], @1);
+    XCTAssertEqualObjects(hitCounts[@"sec"], @3);
+}
+
+- (void)testRedactor200 {
+    SproutRedactor *redactor = [[SproutRedactor alloc] initWithPatterns:@[
+        [SproutRedactionPattern prefix:@"Bearer " name:@"token"],
+        [SproutRedactionPattern prefix:@"password=" name:@"password"],
+        [SproutRedactionPattern emailAddress],
+    ] replacement:@"***"];
+
+    //Prefixes are kept, and their values end at a separator
+    XCTAssertEqualObjects([redactor redactString:@"Authorization: BEARER abc.def, PASSWORD=hunter2&x=1 password="], @"Authorization: BEARER ***, PASSWORD=***&x=1 password=");
+    XCTAssertEqualObjects([redactor redactString:@"From: <jane.doe+logs@example.co.uk> at @home"], @"From: <***> at @home");
+    XCTAssertEqualObjects([redactor hitCounts], (@{ @"token": @1, @"password": @1, @"email": @1 }));
+}
+
+- (void)testRedactor300 {
+    //Anchored regular expressions are only evaluated for messages containing their anchor
+    NSRegularExpression *sessionIDs = [NSRegularExpression regularExpressionWithPattern:@"session=[0-9a-f]{8}" options:0 error:nil];
+    SproutRedactor *redactor = [[SproutRedactor alloc] initWithPatterns:@[
+        [SproutRedactionPattern regularExpression:sessionIDs anchor:@"session=" name:@"session"],
+    ]];
+
+    XCTAssertEqualObjects([redactor redactString:@"café session=0123abcd ok"], @"café <redacted> ok");
+    XCTAssertEqualObjects([redactor redactString:@"SESSION=0123abcd"], @"SESSION=0123abcd");
+    XCTAssertEqualObjects([redactor redactString:@"session=xyz"], @"session=xyz");
+    XCTAssertEqualObjects([redactor hitCounts][@"session"], @1);
+}
+
+- (void)testRedactorCardNumber100 {
+    SproutRedactor *redactor = [[SproutRedactor alloc] initWithPatterns:@[[SproutRedactionPattern cardNumber]]];
+
+    NSArray<NSString *> *cardNumbers = @[@"4111111111111111", @"4111 1111 1111 1111", @"5500-0000-0000-0004", @"378282246310005", @"6011000990139424"];
+    for (NSString *cardNumber in cardNumbers) {
+        NSString *text = [NSString stringWithFormat:@"card %@.", cardNumber];
+        XCTAssertEqualObjects([redactor redactString:text], @"card <redacted>.", @"%@ was not redacted.", cardNumber);
+    }
+    XCTAssertEqualObjects([redactor hitCounts][@"cardNumber"], @(cardNumbers.count));
+
+    NSArray<NSString *> *others = @[
+        @"4111111111111112",        //Fails the Luhn check
+        @"411111111111",            //Too short
+        @"41111111111111111111",    //Too long
+        @"A4111111111111111",       //Part of a longer word
+        @"4111111111111111f",
+        @"4111  1111 1111 1111",    //Not a single separator
+        @"1000000000009",           //Not a payment card's major industry identifier (i.e. a timestamp)
+        @"9000000000001",
+    ];
+    for (NSString *other in others) {
+        NSString *text = [NSString stringWithFormat:@"id %@.", other];
+        XCTAssertEqualObjects([redactor redactString:text], text, @"%@ was redacted.", other);
+    }
+    XCTAssertEqualObjects([redactor hitCounts][@"cardNumber"], @(cardNumbers.count));
+}
+
+- (void)testLogSanitizer100 {
+    //Text with nothing to sanitize (including tabs and non-ASCII text, and longer than one vector) is not copied
+    NSString *clean = @"café\tnaïve — nothing to see in this message, which is longer than 16 bytes";
+    XCTAssert([[SproutLogSanitizer escapingSanitizer] sanitizeString:clean] == clean, @"Text without control characters was copied.");
+    XCTAssert([[SproutLogSanitizer indentingSanitizer] sanitizeString:clean] == clean, @"Text without control characters was copied.");
+
+    NSString *backslash = @"C:\\Windows";
+    XCTAssert([[SproutLogSanitizer indentingSanitizer] sanitizeString:backslash] == backslash, @"Indenting changed a backslash.");
+}
+
+- (void)testLogSanitizer200 {
+    SproutLogSanitizer *sanitizer = [SproutLogSanitizer escapingSanitizer];
+
+    XCTAssertEqualObjects([sanitizer sanitizeString:@"a\nb\rc\\d\x1b e\x7f\tf"], @"a\\nb\\rc\\\\d\\x1b e\\x7f\tf");
+    XCTAssertEqualObjects([sanitizer sanitizeString:@"café\r\n"], @"café\\r\\n");
+    //Found by the vector scan, past the first 16 bytes
+    XCTAssertEqualObjects([sanitizer sanitizeString:@"0123456789abcdefghij\nklmnopqrstuvwxyz0123456789\\"], @"0123456789abcdefghij\\nklmnopqrstuvwxyz0123456789\\\\");
+
+    SproutLogBuffer buffer;
+    SproutLogBufferInit(&buffer);
+    SproutLogBufferAppendCString(&buffer, "message: ");
+    [sanitizer appendString:@"one\ntwo" toBuffer:&buffer];
+    XCTAssertEqualObjects(SproutLogBufferCopyString(&buffer), @"message: one\\ntwo");
+}
+
+- (void)testLogSanitizer300 {
+    SproutLogSanitizer *sanitizer = [SproutLogSanitizer indentingSanitizer];
+
+    //"\r\n" and a lone "\r" are single line breaks, and trailing line breaks are removed
+    XCTAssertEqualObjects([sanitizer sanitizeString:@"first\r\nsecond\rthird\nfourth\n\r\n"], @"first\n    second\n    third\n    fourth");
+    XCTAssertEqualObjects([sanitizer sanitizeString:@"\n"], @"");
+    //Other control characters are escaped, but backslashes are not
+    XCTAssertEqualObjects([sanitizer sanitizeString:@"a\\b\x1b"], @"a\\b\\x1b");
+
+    //Empty lines are kept, with the indent
+    sanitizer = [[SproutLogSanitizer alloc] initWithMode:SproutLogSanitizerModeIndent indent:@"| "];
+    XCTAssertEqualObjects([sanitizer sanitizeString:@"a\n\nb"], @"a\n| \n| b");
+}
+
+- (void)testLogSanitizerScan100 {
+    //The vector scan agrees with a byte at a time scan, at any length and alignment
+    const uint8_t specials[] = { '\n', '\r', '\t', '\\', 0x00, 0x1B, 0x1F, 0x7F, 0x20 };
+    uint8_t bytes[96];
+    for (NSUInteger iteration = 0; iteration < 20000; ++iteration) {
+        size_t offset = arc4random_uniform(16);
+        size_t length = arc4random_uniform((uint32_t)(sizeof(bytes) - offset + 1));
+        //Mostly bytes which need no sanitizing (including non-ASCII), so matches are found anywhere in the scan
+        uint32_t density = arc4random_uniform(64) + 1;
+        for (size_t i = 0; i < sizeof(bytes); ++i) {
+            bytes[i] = arc4random_uniform(density) == 0 ? specials[arc4random_uniform(sizeof(specials))] : (uint8_t)(0x21 + arc4random_uniform(0xDF));
+        }
+
+        for (SproutLogSanitizerMode mode = SproutLogSanitizerModeEscape; mode <= SproutLogSanitizerModeIndent; ++mode) {
+            size_t expected = [self referenceSanitizerScanOfBytes:bytes + offset length:length mode:mode];
+            size_t actual = SproutLogSanitizerScan(bytes + offset, length, mode);
+            if (actual != expected) {
+                XCTFail(@"Scan of %zu bytes at offset %zu (mode %lu) found %zu, not %zu.", length, offset, (unsigned long)mode, actual, expected);
+                return;
+            }
+        }
+    }
+}
+
+- (void)testRedactedFileLogger100 {
+    //A binary file logger writes messages rather than formatting them, but still runs its formatter's stages
+    SproutBinaryFileLogger *fileLogger = [[SproutBinaryFileLogger alloc] initWithLogFileManager:[self logFileManagerWithExtension:SproutBinaryLogFileExtension]];
+    fileLogger.logFormatter = [self emailRedactingLogFormatter];
+
+    DDLogMessage *message = [self logMessage:@"Signed in as jane.doe@example.com" flag:DDLogFlagInfo function:@"main" line:10 timestamp:[NSDate date]];
+    dispatch_sync(fileLogger.loggerQueue, ^{
+        [fileLogger logMessage:message];
+    });
+
+    NSData *data = [self logFileDataOfFileLogger:fileLogger];
+    XCTAssert([self data:data containsString:@"Signed in as <redacted>"], @"The redacted message was not written.");
+    XCTAssertFalse([self data:data containsString:@"jane.doe@example.com"], @"The email address was written.");
+}
+
+- (void)testRedactedFileLogger200 {
+    //File loggers routed to which write their own format are given the message redacted by the router's formatter
+    DDFileLogger *defaultFileLogger = [[DDFileLogger alloc] initWithLogFileManager:[self logFileManagerWithExtension:@"log"]];
+    SproutCompressedFileLogger *compressedFileLogger = [[SproutCompressedFileLogger alloc] initWithLogFileManager:[self logFileManagerWithExtension:SproutCompressedLogFileExtension]];
+    SproutFileLogRouter *router = [[SproutFileLogRouter alloc] initWithDefaultFileLogger:defaultFileLogger];
+    [router setFileLogger:compressedFileLogger forContext:7];
+    router.logFormatter = [self emailRedactingLogFormatter];
+
+    DDLogMessage *message = [[DDLogMessage alloc] initWithMessage:@"Signed in as jane.doe@example.com" level:DDLogLevelAll flag:DDLogFlagInfo context:7 file:@"/path/to/File.m" function:@"main" line:10 tag:nil options:0 timestamp:[NSDate date]];
+    dispatch_sync(router.loggerQueue, ^{
+        [router logMessage:message];
+    });
+
+    NSData *data = [SproutCompressedLogDecoder decodeData:[self logFileDataOfFileLogger:compressedFileLogger] truncated:NULL];
+    XCTAssert([self data:data containsString:@"Signed in as <redacted>"], @"The redacted message was not written.");
+    XCTAssertFalse([self data:data containsString:@"jane.doe@example.com"], @"The email address was written.");
+}
+
+- (void)testCompressedFileLogger100 {
+    SproutCompressedFileLogger *fileLogger = [[SproutCompressedFileLogger alloc] initWithLogFileManager:[self logFileManagerWithExtension:SproutCompressedLogFileExtension]];
+    NSArray<DDLogMessage *> *messages = @[
+        [self logMessage:@"Starting" flag:DDLogFlagInfo function:@"main" line:10 timestamp:[NSDate date]],
+        [self logMessage:@"Crashing" flag:DDLogFlagError function:@"main" line:20 timestamp:[NSDate date]],
+        [self logMessage:@"Still running" flag:DDLogFlagInfo function:@"main" line:30 timestamp:[NSDate date]],
+    ];
+    for (DDLogMessage *message in messages) {
+        dispatch_sync(fileLogger.loggerQueue, ^{
+            [fileLogger logMessage:message];
+        });
+    }
+
+    //The error is written at once (with the message before it), without waiting for a flush
+    NSString *logFilePath = fileLogger.logFileManager.sortedLogFilePaths.firstObject;
+    BOOL truncated = YES;
+    NSData *decoded = [SproutCompressedLogDecoder decodeData:[NSData dataWithContentsOfFile:logFilePath] truncated:&truncated];
+    XCTAssertEqualObjects([[NSString alloc] initWithData:decoded encoding:NSUTF8StringEncoding], @"Starting\nCrashing\n");
+    XCTAssertFalse(truncated);
+
+    [fileLogger flush];
+    NSData *data = [NSData dataWithContentsOfFile:logFilePath];
+    decoded = [SproutCompressedLogDecoder decodeData:data truncated:&truncated];
+    XCTAssertEqualObjects([[NSString alloc] initWithData:decoded encoding:NSUTF8StringEncoding], @"Starting\nCrashing\nStill running\n");
+    XCTAssertFalse(truncated);
+
+    //A file which ends part way through a frame decodes up to the last complete frame
+    NSData *truncatedData = [data subdataWithRange:NSMakeRange(0, data.length - 4)];
+    decoded = [SproutCompressedLogDecoder decodeData:truncatedData truncated:&truncated];
+    XCTAssertEqualObjects([[NSString alloc] initWithData:decoded encoding:NSUTF8StringEncoding], @"Starting\nCrashing\n");
+    XCTAssertTrue(truncated);
+}
+
+- (void)testDisabledLogStatementPerformance100 {
+    uint32_t logLevel = SproutLogLevelGet();
+    SproutLogLevelSet(DDLogLevelWarning);
+
+    [self measureBlock:^{
+        double sum = 0;
+        for (int i = 0; i < 10000000; ++i) {
+            sum += i * 0.5;
+            DDLogVerbose(@"i=%d sum=%f", i, sum);
+        }
+        XCTAssert(sum > 0);
+    }];
+
+    SproutLogLevelSet(logLevel);
+}
+
+- (void)testDisabledLogStatementPerformance200 {
+    //The loop of testDisabledLogStatementPerformance100 without its disabled statement, for comparison
+    [self measureBlock:^{
+        double sum = 0;
+        for (int i = 0; i < 10000000; ++i) {
+            sum += i * 0.5;
+        }
+        XCTAssert(sum > 0);
+    }];
+}
+
 @end
@@ -0,0 +1,542 @@
+//
+//  sproutlog.c
+//
+//  Part of "Sprout" https://github.com/levigroker/Sprout
+//
+//  Created on October 19, 2026.
+//  Copyright (c) 2026 Levi Brown <mailto:levigroker@gmail.com> This work is
+//  licensed under the Creative Commons Attribution 4.0 International License. To
+//  view a copy of this license, visit https://creativecommons.org/licenses/by/4.0/
+//  or send a letter to Creative Commons, PO Box 1866, Mountain View, CA 94042, USA.
+//
+//  The above attribution and the included license must accompany any version of
+//  the source code, binary distributable, or derivatives.
+//
+
+/**
+ Renders binary log files written by `SproutBinaryFileLogger` in the `SproutCustomLogFormatter` text format.
+
+ Usage: sproutlog [-u] [file ...]
+
+ Reads standard input if no files are given. Timestamps are rendered in local time, or UTC with `-u`.
+ Files which end part way through a record are rendered up to the last complete record, a record cut short by the app
+ stopping is skipped when the file resumes with a new segment, and damaged regions are skipped, with a note of each
+ written to standard error.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "../../Sprout/SproutBinaryLogFormat.h"
+
+typedef struct
+{
+    const uint8_t *bytes;
+    size_t length;
+} SproutSlice;
+
+typedef struct
+{
+    uint8_t flag;
+    int64_t context;
+    uint64_t line;
+    SproutSlice file;
+    SproutSlice function;
+} SproutCallSite;
+
+typedef struct
+{
+    SproutCallSite *callSites;
+    size_t callSiteCount;
+    size_t callSiteCapacity;
+    SproutSlice *threads;
+    size_t threadCount;
+    size_t threadCapacity;
+    int64_t timestamp;
+    int inSegment;
+    int utc;
+} SproutDecoder;
+
+//MARK: - Reading
+
+static int sproutReadVarint(SproutSlice *slice, uint64_t *value)
+{
+    size_t length = sproutVarintDecode(slice->bytes, slice->length, value);
+    slice->bytes += length;
+    slice->length -= length;
+    return length > 0;
+}
+
+static int sproutReadByte(SproutSlice *slice, uint8_t *value)
+{
+    if (slice->length < 1)
+    {
+        return 0;
+    }
+    *value = slice->bytes[0];
+    slice->bytes += 1;
+    slice->length -= 1;
+    return 1;
+}
+
+static int sproutReadString(SproutSlice *slice, SproutSlice *string)
+{
+    uint64_t length;
+    if (!sproutReadVarint(slice, &length) || length > slice->length)
+    {
+        return 0;
+    }
+    string->bytes = slice->bytes;
+    string->length = (size_t)length;
+    slice->bytes += length;
+    slice->length -= (size_t)length;
+    return 1;
+}
+
+static void *sproutGrow(void *array, size_t *capacity, size_t count, size_t elementSize)
+{
+    if (count < *capacity)
+    {
+        return array;
+    }
+    size_t newCapacity = *capacity ? *capacity * 2 : 64;
+    void *retVal = realloc(array, newCapacity * elementSize);
+    if (!retVal)
+    {
+        fprintf(stderr, "sproutlog: out of memory\n");
+        exit(EXIT_FAILURE);
+    }
+    *capacity = newCapacity;
+    return retVal;
+}
+
+//MARK: - Rendering
+
+static const char *sproutLevelLabel(uint8_t flag)
+{
+    switch (flag)
+    {
+        case SproutBinaryLogFlagError: return "[ERROR]";
+        case SproutBinaryLogFlagWarning: return " [WARN]";
+        case SproutBinaryLogFlagInfo: return " [INFO]";
+        default: return "[DEBUG]";
+    }
+}
+
+static void sproutFormatTimestamp(int64_t milliseconds, int utc, char *buffer, size_t length)
+{
+    time_t seconds = (time_t)(milliseconds / 1000);
+    int remainder = (int)(milliseconds % 1000);
+    if (remainder < 0)
+    {
+        remainder += 1000;
+        seconds -= 1;
+    }
+
+    struct tm components;
+    if (utc)
+    {
+        gmtime_r(&seconds, &components);
+    }
+    else
+    {
+        localtime_r(&seconds, &components);
+    }
+
+    size_t written = strftime(buffer, length, "%Y-%m-%d %H:%M:%S", &components);
+    snprintf(buffer + written, length - written, ":%03d", remainder);
+}
+
+//Writes the string as is, or quoted if it would otherwise be ambiguous (as `SproutLogFields` renders it)
+static void sproutRenderFieldText(SproutSlice text)
+{
+    int needsQuotes = text.length == 0;
+    for (size_t i = 0; i < text.length && !needsQuotes; ++i)
+    {
+        needsQuotes = text.bytes[i] <= ' ' || text.bytes[i] == '"' || text.bytes[i] == '=' || text.bytes[i] == '\\';
+    }
+
+    if (!needsQuotes)
+    {
+        fwrite(text.bytes, 1, text.length, stdout);
+        return;
+    }
+
+    putchar('"');
+    for (size_t i = 0; i < text.length; ++i)
+    {
+        uint8_t byte = text.bytes[i];
+        if (byte == '"' || byte == '\\')
+        {
+            putchar('\\');
+            putchar(byte);
+        }
+        else if (byte == '\n')
+        {
+            fputs("\\n", stdout);
+        }
+        else
+        {
+            putchar(byte);
+        }
+    }
+    putchar('"');
+}
+
+//Renders the key/value fields following a message as ` key=value` pairs, up to the first malformed field
+static void sproutRenderFields(SproutSlice fields)
+{
+    uint64_t count;
+    if (fields.length == 0 || !sproutReadVarint(&fields, &count))
+    {
+        return;
+    }
+
+    for (uint64_t i = 0; i < count; ++i)
+    {
+        SproutSlice key;
+        uint8_t type;
+        if (!sproutReadString(&fields, &key) || !sproutReadByte(&fields, &type))
+        {
+            return;
+        }
+
+        printf(" %.*s=", (int)key.length, (const char *)key.bytes);
+
+        switch (type)
+        {
+            case SproutBinaryLogFieldTypeInteger:
+            case SproutBinaryLogFieldTypeUnsigned:
+            {
+                uint64_t value;
+                if (!sproutReadVarint(&fields, &value))
+                {
+                    return;
+                }
+                if (type == SproutBinaryLogFieldTypeInteger)
+                {
+                    printf("%lld", (long long)sproutZigzagDecode(value));
+                }
+                else
+                {
+                    printf("%llu", (unsigned long long)value);
+                }
+                break;
+            }
+            case SproutBinaryLogFieldTypeDouble:
+            {
+                if (fields.length < 8)
+                {
+                    return;
+                }
+                uint64_t bits = 0;
+                for (int b = 0; b < 8; ++b)
+                {
+                    bits |= (uint64_t)fields.bytes[b] << (8 * b);
+                }
+                fields.bytes += 8;
+                fields.length -= 8;
+                double value;
+                memcpy(&value, &bits, sizeof(value));
+                printf("%.15g", value);
+                break;
+            }
+            case SproutBinaryLogFieldTypeBool:
+            {
+                uint8_t value;
+                if (!sproutReadByte(&fields, &value))
+                {
+                    return;
+                }
+                fputs(value ? "true" : "false", stdout);
+                break;
+            }
+            case SproutBinaryLogFieldTypeString:
+            {
+                SproutSlice value;
+                if (!sproutReadString(&fields, &value))
+                {
+                    return;
+                }
+                sproutRenderFieldText(value);
+                break;
+            }
+            default:
+                //The encoding of the value is unknown, so nothing after it can be read
+                return;
+        }
+    }
+}
+
+static void sproutRenderMessage(SproutDecoder *decoder, const SproutCallSite *callSite, SproutSlice thread, SproutSlice message, SproutSlice fields)
+{
+    char timestamp[64];
+    sproutFormatTimestamp(decoder->timestamp, decoder->utc, timestamp, sizeof(timestamp));
+
+    printf("%s         <%.*s> %.*s(%.*s %d)\n%s %s %.*s",
+           timestamp,
+           (int)thread.length, (const char *)thread.bytes,
+           (int)callSite->function.length, (const char *)callSite->function.bytes,
+           (int)callSite->file.length, (const char *)callSite->file.bytes,
+           (int)callSite->line,
+           timestamp,
+           sproutLevelLabel(callSite->flag),
+           (int)message.length, (const char *)message.bytes);
+    sproutRenderFields(fields);
+    putchar('\n');
+}
+
+//MARK: - Decoding
+
+//@return Non-zero if the record was valid.
+static int sproutDecodeRecord(SproutDecoder *decoder, uint8_t type, SproutSlice payload)
+{
+    switch (type)
+    {
+        case SproutBinaryLogRecordTypeSegment:
+        {
+            uint8_t version;
+            uint64_t timestamp;
+            if (payload.length < SPROUT_BINARY_LOG_MAGIC_LENGTH || memcmp(payload.bytes, SPROUT_BINARY_LOG_MAGIC, SPROUT_BINARY_LOG_MAGIC_LENGTH) != 0)
+            {
+                return 0;
+            }
+            payload.bytes += SPROUT_BINARY_LOG_MAGIC_LENGTH;
+            payload.length -= SPROUT_BINARY_LOG_MAGIC_LENGTH;
+            if (!sproutReadByte(&payload, &version) || version > SPROUT_BINARY_LOG_VERSION || !sproutReadVarint(&payload, &timestamp))
+            {
+                return 0;
+            }
+            decoder->callSiteCount = 0;
+            decoder->threadCount = 0;
+            decoder->timestamp = (int64_t)timestamp;
+            decoder->inSegment = 1;
+            return 1;
+        }
+        case SproutBinaryLogRecordTypeCallSite:
+        {
+            uint64_t identifier;
+            uint64_t context;
+            SproutCallSite callSite;
+            if (!decoder->inSegment || !sproutReadVarint(&payload, &identifier) || identifier != decoder->callSiteCount
+                || !sproutReadByte(&payload, &callSite.flag) || !sproutReadVarint(&payload, &context) || !sproutReadVarint(&payload, &callSite.line)
+                || !sproutReadString(&payload, &callSite.file) || !sproutReadString(&payload, &callSite.function))
+            {
+                return 0;
+            }
+            callSite.context = sproutZigzagDecode(context);
+            decoder->callSites = sproutGrow(decoder->callSites, &decoder->callSiteCapacity, decoder->callSiteCount, sizeof(SproutCallSite));
+            decoder->callSites[decoder->callSiteCount++] = callSite;
+            return 1;
+        }
+        case SproutBinaryLogRecordTypeThread:
+        {
+            uint64_t identifier;
+            SproutSlice thread;
+            if (!decoder->inSegment || !sproutReadVarint(&payload, &identifier) || identifier != decoder->threadCount || !sproutReadString(&payload, &thread))
+            {
+                return 0;
+            }
+            decoder->threads = sproutGrow(decoder->threads, &decoder->threadCapacity, decoder->threadCount, sizeof(SproutSlice));
+            decoder->threads[decoder->threadCount++] = thread;
+            return 1;
+        }
+        case SproutBinaryLogRecordTypeMessage:
+        {
+            uint64_t delta;
+            uint64_t callSiteID;
+            uint64_t threadID;
+            SproutSlice message;
+            if (!decoder->inSegment || !sproutReadVarint(&payload, &delta) || !sproutReadVarint(&payload, &callSiteID) || !sproutReadVarint(&payload, &threadID)
+                || !sproutReadString(&payload, &message) || callSiteID >= decoder->callSiteCount || threadID >= decoder->threadCount)
+            {
+                return 0;
+            }
+            decoder->timestamp += sproutZigzagDecode(delta);
+            //Anything following the message is its fields
+            sproutRenderMessage(decoder, &decoder->callSites[callSiteID], decoder->threads[threadID], message, payload);
+            return 1;
+        }
+        default:
+            //Unknown record types are skipped
+            return decoder->inSegment;
+    }
+}
+
+//Finds the next SEGMENT record after `offset`, or returns `length` if there is none.
+static size_t sproutNextSegment(const uint8_t *bytes, size_t length, size_t offset)
+{
+    for (size_t i = offset + 1; i + 2 + SPROUT_BINARY_LOG_MAGIC_LENGTH <= length; ++i)
+    {
+        const uint8_t *magic = memchr(bytes + i, SPROUT_BINARY_LOG_MAGIC[0], length - i);
+        if (!magic)
+        {
+            break;
+        }
+        i = (size_t)(magic - bytes);
+        //A segment record is the type byte, a one byte length (covering the magic, the version and a timestamp varint),
+        //then the magic and a version this tool reads
+        if (i >= 2 && i - 2 > offset && bytes[i - 2] == SproutBinaryLogRecordTypeSegment
+            && bytes[i - 1] > SPROUT_BINARY_LOG_MAGIC_LENGTH + 1 && bytes[i - 1] <= SPROUT_BINARY_LOG_MAGIC_LENGTH + 1 + SPROUT_VARINT_MAX_LENGTH
+            && i + SPROUT_BINARY_LOG_MAGIC_LENGTH < length && memcmp(magic, SPROUT_BINARY_LOG_MAGIC, SPROUT_BINARY_LOG_MAGIC_LENGTH) == 0
+            && bytes[i + SPROUT_BINARY_LOG_MAGIC_LENGTH] <= SPROUT_BINARY_LOG_VERSION)
+        {
+            return i - 2;
+        }
+    }
+    return length;
+}
+
+static int sproutDecode(const char *name, const uint8_t *bytes, size_t length, int utc)
+{
+    int retVal = EXIT_SUCCESS;
+    SproutDecoder decoder;
+    memset(&decoder, 0, sizeof(decoder));
+    decoder.utc = utc;
+
+    size_t offset = 0;
+    //The first SEGMENT record after `offset` (found again once `offset` passes it)
+    size_t nextSegment = sproutNextSegment(bytes, length, offset);
+    while (offset < length)
+    {
+        if (offset >= nextSegment)
+        {
+            nextSegment = sproutNextSegment(bytes, length, offset);
+        }
+
+        SproutSlice slice = { bytes + offset + 1, length - offset - 1 };
+        uint8_t type = bytes[offset];
+        uint64_t payloadLength;
+        size_t payloadOffset;
+
+        int framed = sproutReadVarint(&slice, &payloadLength) && payloadLength <= slice.length;
+        payloadOffset = (size_t)(slice.bytes - bytes);
+        if (!framed && nextSegment == length)
+        {
+            //The last record is incomplete
+            fprintf(stderr, "sproutlog: %s: truncated at offset %zu\n", name, offset);
+            break;
+        }
+
+        //The app resumes writing a file with a new segment, so a record which runs on into a segment (or past the end of
+        //the file, with a segment to follow) was cut short when the app last stopped. Decoding resumes at the segment.
+        if (!framed || nextSegment < payloadOffset + payloadLength)
+        {
+            fprintf(stderr, "sproutlog: %s: truncated at offset %zu, resumed at offset %zu\n", name, offset, nextSegment);
+            decoder.inSegment = 0;
+            offset = nextSegment;
+            continue;
+        }
+
+        SproutSlice payload = { slice.bytes, (size_t)payloadLength };
+        if (sproutDecodeRecord(&decoder, type, payload))
+        {
+            offset = payloadOffset + (size_t)payloadLength;
+        }
+        else
+        {
+            fprintf(stderr, "sproutlog: %s: skipped %zu damaged bytes at offset %zu\n", name, nextSegment - offset, offset);
+            decoder.inSegment = 0;
+            retVal = EXIT_FAILURE;
+            offset = nextSegment;
+        }
+    }
+
+    free(decoder.callSites);
+    free(decoder.threads);
+
+    return retVal;
+}
+
+//MARK: - Main
+
+static uint8_t *sproutReadAll(FILE *file, size_t *length)
+{
+    size_t capacity = 64 * 1024;
+    size_t count = 0;
+    uint8_t *retVal = malloc(capacity);
+
+    while (retVal)
+    {
+        count += fread(retVal + count, 1, capacity - count, file);
+        if (count < capacity)
+        {
+            break;
+        }
+        capacity *= 2;
+        uint8_t *grown = realloc(retVal, capacity);
+        if (!grown)
+        {
+            free(retVal);
+            retVal = NULL;
+        }
+        else
+        {
+            retVal = grown;
+        }
+    }
+
+    *length = count;
+    return retVal;
+}
+
+static int sproutDecodeFile(const char *path, FILE *file, int utc)
+{
+    size_t length = 0;
+    uint8_t *bytes = sproutReadAll(file, &length);
+    if (!bytes || ferror(file))
+    {
+        fprintf(stderr, "sproutlog: %s: could not be read\n", path);
+        free(bytes);
+        return EXIT_FAILURE;
+    }
+
+    int retVal = sproutDecode(path, bytes, length, utc);
+    free(bytes);
+    return retVal;
+}
+
+int main(int argc, char *argv[])
+{
+    int utc = 0;
+    int option;
+    while ((option = getopt(argc, argv, "u")) != -1)
+    {
+        switch (option)
+        {
+            case 'u':
+                utc = 1;
+                break;
+            default:
+                fprintf(stderr, "usage: sproutlog [-u] [file ...]\n");
+                return EXIT_FAILURE;
+        }
+    }
+
+    if (optind >= argc)
+    {
+        return sproutDecodeFile("<stdin>", stdin, utc);
+    }
+
+    int retVal = EXIT_SUCCESS;
+    for (int i = optind; i < argc; ++i)
+    {
+        FILE *file = fopen(argv[i], "rb");
+        if (!file)
+        {
+            perror(argv[i]);
+            retVal = EXIT_FAILURE;
+            continue;
+        }
+        if (sproutDecodeFile(argv[i], file, utc) != EXIT_SUCCESS)
+        {
+            retVal = EXIT_FAILURE;
+        }
+        fclose(file);
+    }
+
+    return retVal;
+}
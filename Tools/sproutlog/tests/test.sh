@@ -0,0 +1,59 @@
+#!/bin/sh
+# Decodes binary log fixtures with `sproutlog -u` and compares the output with the expected text.
+# Usage: tests/test.sh path/to/sproutlog
+
+set -u
+
+SPROUTLOG=${1:-./sproutlog}
+WORK=$(mktemp -d)
+trap 'rm -rf "$WORK"' EXIT
+FAILURES=0
+
+# Records: type byte, varint payload length, payload (see Sprout/SproutBinaryLogFormat.h)
+SEGMENT1='\001\007SPBL\001\350\007'      # segment at 1000 ms
+SEGMENT2='\001\007SPBL\001\320\017'      # segment at 2000 ms
+CALLSITE='\002\012\000\004\000\014\003a.m\001f' # call site 0: info, line 12, a.m, f
+THREAD='\003\006\000\004main'             # thread 0: main
+HELLO='\004\011\000\000\000\005hello'
+AGAIN='\004\011\000\000\000\005again'
+CUT='\004\011\000\000\000\005he'          # a message the app stopped writing part way through
+
+HELLO_LINES='1970-01-01 00:00:01:000         <main> f(a.m 12)
+1970-01-01 00:00:01:000  [INFO] hello'
+AGAIN_LINES='1970-01-01 00:00:02:000         <main> f(a.m 12)
+1970-01-01 00:00:02:000  [INFO] again'
+
+# check <name> <expected status> <expected output> <records...>
+check()
+{
+    name=$1
+    status=$2
+    expected=$3
+    shift 3
+    printf "$*" > "$WORK/$name.logb"
+    actual=$("$SPROUTLOG" -u "$WORK/$name.logb" 2> "$WORK/$name.err")
+    actualStatus=$?
+    if [ "$actual" != "$expected" ] || [ "$actualStatus" -ne "$status" ]
+    then
+        echo "FAIL: $name (status $actualStatus, expected $status)"
+        printf '%s\n' "$expected" > "$WORK/$name.expected"
+        printf '%s\n' "$actual" | diff -u "$WORK/$name.expected" -
+        cat "$WORK/$name.err"
+        FAILURES=$((FAILURES + 1))
+    else
+        echo "ok: $name"
+    fi
+}
+
+check complete 0 "$HELLO_LINES" "$SEGMENT1$CALLSITE$THREAD$HELLO"
+check truncated 0 "$HELLO_LINES" "$SEGMENT1$CALLSITE$THREAD$HELLO$CUT"
+check resumed 0 "$HELLO_LINES
+$AGAIN_LINES" "$SEGMENT1$CALLSITE$THREAD$HELLO$SEGMENT2$CALLSITE$THREAD$AGAIN"
+check truncated-then-resumed 0 "$HELLO_LINES
+$AGAIN_LINES" "$SEGMENT1$CALLSITE$THREAD$HELLO$CUT$SEGMENT2$CALLSITE$THREAD$AGAIN"
+check truncated-length-then-resumed 0 "$HELLO_LINES
+$AGAIN_LINES" "$SEGMENT1$CALLSITE$THREAD$HELLO\\004$SEGMENT2$CALLSITE$THREAD$AGAIN"
+check damaged 1 "$HELLO_LINES
+$AGAIN_LINES" "$SEGMENT1$CALLSITE$THREAD$HELLO\\004\\001\\000$SEGMENT2$CALLSITE$THREAD$AGAIN"
+
+[ "$FAILURES" -eq 0 ]